@@ -0,0 +1,98 @@
+#include "Bench.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace {
+    std::atomic<std::uint64_t> allocations{0};
+
+    std::vector<bench::Case>& registry() {
+        static std::vector<bench::Case> cases;
+        return cases;
+    }
+
+    double secondsFor(const bench::Case& c, std::uint64_t iterations) {
+        using Clock = std::chrono::steady_clock;
+        const Clock::time_point start = Clock::now();
+        c.run(iterations);
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    double median(std::vector<double> values) {
+        std::sort(values.begin(), values.end());
+        const std::size_t mid = values.size() / 2;
+        return values.size() % 2 ? values[mid] : (values[mid - 1] + values[mid]) / 2.0;
+    }
+}
+
+// Count every heap allocation in the process
+void* operator new(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+namespace bench {
+
+void add(const std::string& name, std::uint64_t itemsPerOp, std::function<void()> setup,
+         std::function<void(std::uint64_t)> run) {
+    registry().push_back(Case{name, itemsPerOp, std::move(setup), std::move(run)});
+}
+
+std::uint64_t allocationCount() {
+    return allocations.load(std::memory_order_relaxed);
+}
+
+int runAll(const Options& options) {
+    std::printf("%-36s %14s %8s %14s %12s\n", "benchmark", "ns/op", "cv%", "items/s", "allocs/op");
+    for (const Case& c : registry()) {
+        if (!options.filter.empty() && c.name.find(options.filter) == std::string::npos) continue;
+
+        if (c.setup) c.setup();
+
+        // Calibrate: double the batch until it runs long enough to time reliably
+        std::uint64_t iterations = 1;
+        while (secondsFor(c, iterations) < options.minBatchSeconds && iterations < (1ull << 40)) {
+            iterations *= 2;
+        }
+
+        std::vector<double> nsPerOp;
+        std::uint64_t allocationsTotal = 0;
+        for (int rep = 0; rep < options.repetitions; ++rep) {
+            const std::uint64_t allocationsBefore = allocationCount();
+            const double seconds = secondsFor(c, iterations);
+            allocationsTotal += allocationCount() - allocationsBefore;
+            nsPerOp.push_back(seconds * 1e9 / static_cast<double>(iterations));
+        }
+
+        const double med = median(nsPerOp);
+        double mean = 0.0;
+        for (double v : nsPerOp) mean += v;
+        mean /= static_cast<double>(nsPerOp.size());
+        double variance = 0.0;
+        for (double v : nsPerOp) variance += (v - mean) * (v - mean);
+        const double cv = mean > 0.0 ? std::sqrt(variance / static_cast<double>(nsPerOp.size())) / mean * 100.0 : 0.0;
+        const double itemsPerSecond = med > 0.0 ? static_cast<double>(c.itemsPerOp) * 1e9 / med : 0.0;
+        const double allocsPerOp = static_cast<double>(allocationsTotal) /
+                                   (static_cast<double>(iterations) * static_cast<double>(options.repetitions));
+
+        std::printf("%-36s %14.1f %8.2f %14.4g %12.2f\n", c.name.c_str(), med, cv, itemsPerSecond, allocsPerOp);
+        std::fflush(stdout);
+    }
+    return 0;
+}
+
+} // namespace bench
@@ -0,0 +1,47 @@
+#ifndef BENCH_HPP
+#define BENCH_HPP
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Minimal microbenchmark harness. Each case is calibrated so one repetition
+// runs for at least the minimum batch time, then repeated; the median is
+// reported together with the spread so noisy runs are easy to spot.
+namespace bench {
+
+struct Case {
+    std::string name;
+    std::uint64_t itemsPerOp;             // Work items one op processes (e.g. projectiles)
+    std::function<void()> setup;          // Runs once before calibration, untimed
+    std::function<void(std::uint64_t)> run; // Runs the op the given number of times
+};
+
+struct Options {
+    std::string filter;          // Only run cases whose name contains this
+    int repetitions = 10;
+    double minBatchSeconds = 0.05;
+};
+
+void add(const std::string& name, std::uint64_t itemsPerOp, std::function<void()> setup,
+         std::function<void(std::uint64_t)> run);
+int runAll(const Options& options);
+
+// Number of global operator new calls so far (counted by Bench.cpp)
+std::uint64_t allocationCount();
+
+// Keeps the optimizer from discarding a result
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+} // namespace bench
+
+#endif
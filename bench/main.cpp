@@ -0,0 +1,398 @@
+#include "Bench.hpp"
+#include "AsteroidField.hpp"
+#include "Attack.hpp"
+#include "FrameArena.hpp"
+#include "HudText.hpp"
+#include "JobSystem.hpp"
+#include "Player.hpp"
+#include "ProjectileCollider.hpp"
+#include "ParticleSystem.hpp"
+#include "ProjectileKernels.hpp"
+#include "Simulation.hpp"
+#include "StateBuffer.hpp"
+#include "WorldChunks.hpp"
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+    constexpr float TICK_DELTA = 1.f / 120.f;
+    constexpr float FAR_AWAY = 1e9f; // World size big enough that nothing is culled while timing
+    const sf::Vector2f SPAWN_POINT(FAR_AWAY / 2.f, FAR_AWAY / 2.f);
+    const sf::Vector2f SCREEN_CENTER(400.f, 300.f);
+    constexpr float SPREAD_DEG = 137.5f; // Golden angle, so projectiles fan out evenly
+
+    const char* optionValue(const std::string& arg, const std::string& name) {
+        const std::string prefix = "--" + name + "=";
+        return arg.compare(0, prefix.size(), prefix) == 0 ? arg.c_str() + prefix.size() : nullptr;
+    }
+
+    std::string countLabel(std::size_t count) {
+        return count >= 1000000 ? std::to_string(count / 1000000) + "M" : std::to_string(count / 1000) + "k";
+    }
+
+    void addAttackBenchmarks() {
+        for (std::size_t count : {1000u, 10000u, 100000u, 1000000u}) {
+            auto attack = std::make_shared<Attack>();
+            bench::add("Attack::update/" + countLabel(count), count,
+                [attack, count] {
+                    attack->setProjectilePool(count, PoolOverflowPolicy::Refuse);
+                    attack->setWorldSize(sf::Vector2f(FAR_AWAY, FAR_AWAY));
+                    for (std::size_t i = 0; i < count; ++i) {
+                        attack->fire(SPAWN_POINT, static_cast<float>(i) * SPREAD_DEG);
+                    }
+                },
+                [attack](std::uint64_t iterations) {
+                    for (std::uint64_t i = 0; i < iterations; ++i) {
+                        attack->update(TICK_DELTA, SPAWN_POINT, 0.f, false);
+                    }
+                    bench::doNotOptimize(attack->getProjectiles().size());
+                });
+        }
+
+        // The same update split across the job system, to check scaling
+        constexpr std::size_t THREADED_COUNT = 1000000;
+        for (std::size_t threads : {1u, 2u, 4u, 8u, 16u}) {
+            auto attack = std::make_shared<Attack>();
+            auto jobs = std::make_shared<JobSystem>(threads);
+            bench::add("Attack::update/" + countLabel(THREADED_COUNT) + "/threads=" + std::to_string(threads), THREADED_COUNT,
+                [attack, jobs] {
+                    attack->setProjectilePool(THREADED_COUNT, PoolOverflowPolicy::Refuse);
+                    attack->setWorldSize(sf::Vector2f(FAR_AWAY, FAR_AWAY));
+                    attack->setJobSystem(jobs.get());
+                    for (std::size_t i = 0; i < THREADED_COUNT; ++i) {
+                        attack->fire(SPAWN_POINT, static_cast<float>(i) * SPREAD_DEG);
+                    }
+                },
+                [attack](std::uint64_t iterations) {
+                    for (std::uint64_t i = 0; i < iterations; ++i) {
+                        attack->update(TICK_DELTA, SPAWN_POINT, 0.f, false);
+                    }
+                    bench::doNotOptimize(attack->getProjectiles().size());
+                });
+        }
+
+        // The raw kernel on every instruction set this CPU supports
+        constexpr std::size_t KERNEL_COUNT = 100000;
+        for (int level = 0; level <= static_cast<int>(detectSimdLevel()); ++level) {
+            const SimdLevel simd = static_cast<SimdLevel>(level);
+            auto store = std::make_shared<ProjectileStore>(KERNEL_COUNT);
+            bench::add(std::string("integrateAndCull/") + simdLevelName(simd) + "/" + countLabel(KERNEL_COUNT), KERNEL_COUNT,
+                [store] {
+                    store->clear();
+                    for (std::size_t i = 0; i < KERNEL_COUNT; ++i) {
+                        store->add(SPAWN_POINT, sf::Vector2f(1.f, -1.f), 2.f, 0xFFFFFFFF);
+                    }
+                },
+                [store, simd](std::uint64_t iterations) {
+                    for (std::uint64_t i = 0; i < iterations; ++i) {
+                        std::size_t survivors = integrateAndCull(simd, store->arrays(), store->size(), TICK_DELTA, FAR_AWAY, FAR_AWAY);
+                        store->commitCull(survivors);
+                    }
+                });
+        }
+    }
+
+    void addPlayerBenchmarks() {
+        constexpr std::uint64_t THRUST_PERIOD = 64; // Alternate thrust and coasting to hit the friction path
+
+        auto player = std::make_shared<Player>(SCREEN_CENTER.x, SCREEN_CENTER.y);
+        bench::add("Player::applyMovementForce", 1, nullptr,
+            [player](std::uint64_t iterations) {
+                for (std::uint64_t i = 0; i < iterations; ++i) {
+                    player->applyMovementForce(1.f, TICK_DELTA, static_cast<float>(i & 255));
+                }
+                bench::doNotOptimize(player->getVelocity());
+            });
+        bench::add("Player::updateMovement", 1, nullptr,
+            [player](std::uint64_t iterations) {
+                for (std::uint64_t i = 0; i < iterations; ++i) {
+                    player->updateMovement(TICK_DELTA, (i / THRUST_PERIOD) % 2 ? 1.f : 0.f);
+                }
+                bench::doNotOptimize(player->getPosition());
+            });
+        bench::add("Player::move (force + update)", 1, nullptr,
+            [player](std::uint64_t iterations) {
+                for (std::uint64_t i = 0; i < iterations; ++i) {
+                    const float force = (i / THRUST_PERIOD) % 2 ? 1.f : 0.f;
+                    player->applyMovementForce(force, TICK_DELTA, static_cast<float>(i & 255));
+                    player->updateMovement(TICK_DELTA, force);
+                }
+                bench::doNotOptimize(player->getPosition());
+            });
+    }
+
+    // Fixed-seed LCG so every run scatters bodies the same way
+    float nextRandom(std::uint32_t& state) {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<float>(state >> 8) / static_cast<float>(1u << 24);
+    }
+
+    struct CollisionScene {
+        ProjectileStore projectiles{0};
+        std::vector<float> targetX, targetY, targetRadius;
+        ProjectileCollider collider;
+
+        CollisionBodies bodies() const {
+            return CollisionBodies{targetX.data(), targetY.data(), targetRadius.data(), targetX.size()};
+        }
+    };
+
+    void addCollisionBenchmarks() {
+        constexpr std::size_t PROJECTILES = 50000;
+        constexpr std::size_t TARGETS = 5000;
+        const sf::Vector2f world(1920.f, 1080.f);
+        constexpr float MIN_TARGET_RADIUS = 4.f;
+        constexpr float MAX_TARGET_RADIUS = 16.f;
+
+        auto scene = std::make_shared<CollisionScene>();
+        auto setup = [scene, world] {
+            std::uint32_t seed = 12345;
+            scene->projectiles = ProjectileStore(PROJECTILES);
+            for (std::size_t i = 0; i < PROJECTILES; ++i) {
+                const sf::Vector2f position(nextRandom(seed) * world.x, nextRandom(seed) * world.y);
+                scene->projectiles.add(position, sf::Vector2f(0.f, 0.f), 2.f, 0xFFFFFFFF);
+            }
+            scene->targetX.resize(TARGETS);
+            scene->targetY.resize(TARGETS);
+            scene->targetRadius.resize(TARGETS);
+            for (std::size_t i = 0; i < TARGETS; ++i) {
+                scene->targetX[i] = nextRandom(seed) * world.x;
+                scene->targetY[i] = nextRandom(seed) * world.y;
+                scene->targetRadius[i] = MIN_TARGET_RADIUS + nextRandom(seed) * (MAX_TARGET_RADIUS - MIN_TARGET_RADIUS);
+            }
+            scene->collider = ProjectileCollider();
+            scene->collider.setWorldSize(world);
+        };
+
+        // Targets at rest: the grid rebuild is skipped after the first tick
+        bench::add("ProjectileCollider::detect/50k x 5k", PROJECTILES, setup,
+            [scene](std::uint64_t iterations) {
+                for (std::uint64_t i = 0; i < iterations; ++i) {
+                    bench::doNotOptimize(scene->collider.detect(scene->projectiles, scene->bodies()).size());
+                }
+            });
+
+        // Every target changes cells every tick, so the grid is rebuilt each time
+        bench::add("ProjectileCollider::detect/50k x 5k moving", PROJECTILES, setup,
+            [scene](std::uint64_t iterations) {
+                constexpr float STEP = 64.f; // Wider than the automatic cell size for these radii
+                for (std::uint64_t i = 0; i < iterations; ++i) {
+                    const float offset = (i % 2) ? -STEP : STEP;
+                    for (float& x : scene->targetX) x += offset;
+                    bench::doNotOptimize(scene->collider.detect(scene->projectiles, scene->bodies()).size());
+                }
+            });
+
+        // The projectile walk split across the job system, targets at rest
+        for (std::size_t threads : {1u, 2u, 4u, 8u}) {
+            auto jobs = std::make_shared<JobSystem>(threads);
+            bench::add("ProjectileCollider::detect/50k x 5k/threads=" + std::to_string(threads), PROJECTILES,
+                [scene, setup, jobs] {
+                    setup();
+                    scene->collider.setJobSystem(jobs.get());
+                },
+                [scene](std::uint64_t iterations) {
+                    for (std::uint64_t i = 0; i < iterations; ++i) {
+                        bench::doNotOptimize(scene->collider.detect(scene->projectiles, scene->bodies()).size());
+                    }
+                });
+        }
+    }
+
+    // A whole tick at the collision benchmark's scale. Asteroids move and are
+    // binned into the collision grid on the job system (binning waits on the
+    // move through a job dependency) while the main thread runs the attack.
+    // Projectiles stand still in a world sparse enough that the counts stay
+    // within a few percent over thousands of ticks.
+    void addSimulationBenchmarks() {
+        constexpr std::size_t PROJECTILES = 50000;
+        constexpr std::size_t ASTEROIDS = 5000;
+        const sf::Vector2f world(32768.f, 32768.f);
+        for (std::size_t threads : {1u, 2u, 4u, 8u}) {
+            auto simulation = std::make_shared<Simulation>(world);
+            auto jobs = std::make_shared<JobSystem>(threads);
+            bench::add("Simulation::step/50k x 5k/threads=" + std::to_string(threads), PROJECTILES,
+                [simulation, jobs, world] {
+                    std::uint32_t seed = 12345;
+                    Attack& attack = simulation->getAttack();
+                    attack.setProjectilePool(PROJECTILES, PoolOverflowPolicy::Refuse);
+                    attack.setProjectileSpeed(0.f);
+                    for (std::size_t i = 0; i < PROJECTILES; ++i) {
+                        attack.fire(sf::Vector2f(nextRandom(seed) * world.x, nextRandom(seed) * world.y), 0.f);
+                    }
+                    simulation->getAsteroids().clear();
+                    simulation->spawnAsteroids(ASTEROIDS);
+                    simulation->setJobSystem(jobs.get());
+                },
+                [simulation](std::uint64_t iterations) {
+                    for (std::uint64_t i = 0; i < iterations; ++i) {
+                        simulation->step(TICK_DELTA, TickInput());
+                    }
+                    bench::doNotOptimize(simulation->getAttack().getProjectiles().size());
+                });
+        }
+    }
+
+    void addAsteroidBenchmarks() {
+        constexpr std::size_t ASTEROIDS = 20000;
+        const sf::Vector2f world(1920.f, 1080.f);
+        auto field = std::make_shared<AsteroidField>(ASTEROIDS);
+        bench::add("AsteroidField::update/20k", ASTEROIDS,
+            [field, world] {
+                field->clear();
+                field->spawnRandom(ASTEROIDS, world, 1);
+            },
+            [field, world](std::uint64_t iterations) {
+                for (std::uint64_t i = 0; i < iterations; ++i) {
+                    field->update(TICK_DELTA, world);
+                }
+                bench::doNotOptimize(field->positionsX()[0]);
+            });
+    }
+
+    // Per-frame view culling: bucket every projectile, then collect those near
+    // a 1080p view of a much larger world
+    void addCullingBenchmarks() {
+        constexpr std::size_t POINTS = 100000;
+        constexpr float CHUNK_SIZE = 256.f;
+        const sf::Vector2f world(16384.f, 16384.f);
+        const sf::Vector2f view(1920.f, 1080.f);
+        struct CullScene {
+            std::vector<float> x, y;
+            std::vector<std::uint32_t> visible;
+            WorldChunks chunks{CHUNK_SIZE};
+        };
+        auto scene = std::make_shared<CullScene>();
+        bench::add("WorldChunks::build+query/100k in 16k world", POINTS,
+            [scene, world] {
+                std::uint32_t seed = 777;
+                scene->x.resize(POINTS);
+                scene->y.resize(POINTS);
+                for (std::size_t i = 0; i < POINTS; ++i) {
+                    scene->x[i] = nextRandom(seed) * world.x;
+                    scene->y[i] = nextRandom(seed) * world.y;
+                }
+                scene->visible.reserve(POINTS);
+                scene->chunks.setWorldSize(world);
+            },
+            [scene, world, view](std::uint64_t iterations) {
+                const sf::Vector2f topLeft = (world - view) / 2.f;
+                for (std::uint64_t i = 0; i < iterations; ++i) {
+                    scene->chunks.build(scene->x.data(), scene->y.data(), POINTS);
+                    scene->visible.clear();
+                    scene->chunks.query(topLeft.x, topLeft.y, topLeft.x + view.x, topLeft.y + view.y, scene->visible);
+                }
+                bench::doNotOptimize(scene->visible.size());
+            });
+    }
+
+    // One rewind keyframe: SimulationHistory takes these every 30 ticks, so
+    // the per-tick capture cost is about a thirtieth of saveState
+    void addSnapshotBenchmarks() {
+        constexpr std::size_t PROJECTILES = 10000;
+        constexpr std::size_t ASTEROIDS = 2000;
+        const sf::Vector2f world(1920.f, 1080.f);
+        auto simulation = std::make_shared<Simulation>(world);
+        auto state = std::make_shared<StateBuffer>();
+        auto setup = [simulation, state, world] {
+            Attack& attack = simulation->getAttack();
+            attack.setProjectilePool(PROJECTILES, PoolOverflowPolicy::Refuse);
+            for (std::size_t i = 0; i < PROJECTILES; ++i) {
+                attack.fire(world / 2.f, static_cast<float>(i) * SPREAD_DEG);
+            }
+            simulation->getAsteroids().clear();
+            simulation->spawnAsteroids(ASTEROIDS);
+            state->clear();
+            simulation->saveState(*state);
+        };
+        bench::add("Simulation::saveState/10k projectiles", PROJECTILES, setup,
+            [simulation, state](std::uint64_t iterations) {
+                for (std::uint64_t i = 0; i < iterations; ++i) {
+                    state->clear();
+                    simulation->saveState(*state);
+                }
+                bench::doNotOptimize(state->size());
+            });
+        bench::add("Simulation::loadState/10k projectiles", PROJECTILES, setup,
+            [simulation, state](std::uint64_t iterations) {
+                for (std::uint64_t i = 0; i < iterations; ++i) {
+                    StateReader in(*state);
+                    bench::doNotOptimize(simulation->loadState(in));
+                }
+            });
+    }
+
+    // A full frame of particle work at the 500k target, per instruction set.
+    // Lifetimes outlast the run, so the count holds steady.
+    void addParticleBenchmarks() {
+        constexpr std::size_t PARTICLES = 500000;
+        constexpr float FRAME_DELTA = 1.f / 60.f;
+        constexpr float FOREVER_S = 1e9f;
+        for (int level = 0; level <= static_cast<int>(detectSimdLevel()); ++level) {
+            const SimdLevel simd = static_cast<SimdLevel>(level);
+            auto particles = std::make_shared<ParticleSystem>(PARTICLES);
+            particles->setDrag(0.5f);
+            bench::add(std::string("ParticleSystem::update/") + simdLevelName(simd) + "/" + countLabel(PARTICLES), PARTICLES,
+                [particles] {
+                    particles->clear();
+                    for (std::size_t i = 0; i < PARTICLES; ++i) {
+                        const float angle = static_cast<float>(i) * SPREAD_DEG;
+                        particles->spawn(SCREEN_CENTER, sf::Vector2f(angle, -angle), FOREVER_S, 0xFFFFFFFF);
+                    }
+                },
+                [particles, simd](std::uint64_t iterations) {
+                    for (std::uint64_t i = 0; i < iterations; ++i) {
+                        particles->update(simd, FRAME_DELTA);
+                    }
+                    bench::doNotOptimize(particles->size());
+                });
+        }
+    }
+
+    // Reset, lines and text, as Game does every frame; allocs/op should be 0
+    void addHudBenchmarks() {
+        constexpr std::size_t ARENA_BYTES = 4096;
+        constexpr std::size_t MAX_LINES = 8;
+        auto player = std::make_shared<Player>(SCREEN_CENTER.x + 12.5f, SCREEN_CENTER.y - 40.25f);
+        auto arena = std::make_shared<FrameArena>(ARENA_BYTES);
+        bench::add("buildHudLines (per frame)", 1, nullptr,
+            [player, arena](std::uint64_t iterations) {
+                for (std::uint64_t i = 0; i < iterations; ++i) {
+                    arena->reset();
+                    ArenaVector<std::string_view> lines{ArenaAllocator<std::string_view>(*arena)};
+                    lines.reserve(MAX_LINES);
+                    buildHudLines(*player, SCREEN_CENTER, 120.f, 1.f, *arena, lines);
+                    bench::doNotOptimize(lines.size());
+                }
+            });
+    }
+}
+
+int main(int argc, char* argv[]) {
+    bench::Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (const char* value = optionValue(arg, "filter")) {
+            options.filter = value;
+        } else if (const char* value = optionValue(arg, "reps")) {
+            options.repetitions = std::max(1, std::atoi(value));
+        } else if (const char* value = optionValue(arg, "min-time-ms")) {
+            options.minBatchSeconds = std::atof(value) / 1000.0;
+        }
+    }
+
+    addAttackBenchmarks();
+    addPlayerBenchmarks();
+    addCollisionBenchmarks();
+    addSimulationBenchmarks();
+    addAsteroidBenchmarks();
+    addCullingBenchmarks();
+    addSnapshotBenchmarks();
+    addParticleBenchmarks();
+    addHudBenchmarks();
+    return bench::runAll(options);
+}
@@ -0,0 +1,81 @@
+#ifndef ASSET_PACK_HPP
+#define ASSET_PACK_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// On-disk layout of an asset pack (native endianness, little-endian in practice):
+//   AssetPackHeader
+//   AssetPackEntry[entryCount], sorted by name
+//   names, back to back, not terminated
+//   data, each entry starting on an ASSET_PACK_ALIGNMENT boundary
+// Names are paths relative to the assets directory, lowercased, with '/'
+// separators, so lookups don't depend on the platform's case rules.
+constexpr char ASSET_PACK_MAGIC[4] = {'A', 'P', 'A', 'K'};
+constexpr std::uint32_t ASSET_PACK_VERSION = 1;
+constexpr std::size_t ASSET_PACK_ALIGNMENT = 64;
+
+struct AssetPackHeader {
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t entryCount;
+    std::uint32_t namesSize;
+};
+
+struct AssetPackEntry {
+    std::uint32_t nameOffset; // From the start of the names block
+    std::uint32_t nameLength;
+    std::uint64_t dataOffset; // From the start of the file
+    std::uint64_t size;
+};
+
+// One asset's bytes inside the mapped pack
+struct AssetView {
+    const void* data = nullptr;
+    std::size_t size = 0;
+    explicit operator bool() const { return data != nullptr; }
+};
+
+// A file to pack, and the name it will be found by
+struct AssetPackSource {
+    std::string name;
+    std::string path;
+};
+
+// Read-only, memory-mapped asset pack. find() returns pointers straight into
+// the mapping, so they stay valid until the pack is closed or destroyed.
+class AssetPack {
+public:
+    AssetPack();
+    ~AssetPack();
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+
+    bool open(const std::string& path); // Maps the file and validates its index
+    void close();
+    bool isOpen() const;
+
+    AssetView find(const std::string& name) const; // Binary search; the name is normalized first
+    std::size_t getEntryCount() const;
+    std::size_t getMappedBytes() const;
+
+    static std::string normalizeName(const std::string& name);
+
+    // Packs sources into outputPath. Returns false, with a message in error, on failure.
+    static bool write(const std::string& outputPath, std::vector<AssetPackSource> sources, std::string& error);
+
+private:
+    const unsigned char* base;
+    std::size_t mappedBytes;
+    const AssetPackEntry* entries;
+    std::size_t entryCount;
+    const char* names;
+#ifdef _WIN32
+    void* fileHandle;
+    void* mappingHandle;
+#endif
+};
+
+#endif
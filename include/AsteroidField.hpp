@@ -0,0 +1,113 @@
+#ifndef ASTEROID_FIELD_HPP
+#define ASTEROID_FIELD_HPP
+
+#include "SpatialGrid.hpp"
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class StateBuffer;
+class StateReader;
+
+// Stable reference to one asteroid; stops resolving once it is destroyed
+struct AsteroidId {
+    std::uint32_t slot = 0;
+    std::uint32_t generation = 0; // 0 is never issued, so a default id is invalid
+
+    bool isValid() const { return generation != 0; }
+};
+
+// Starting state for one asteroid
+struct AsteroidSpawn {
+    sf::Vector2f position;
+    sf::Vector2f velocity;
+    float radius;
+    float health;
+    std::uint32_t color; // RGBA, same packing as sf::Color::toInteger()
+};
+
+// All asteroids, stored as a sparse set: ids map through a slot table to a
+// packed range of per-component arrays (transform, velocity, radius, health,
+// render color), so every system iterates contiguous memory with no gaps.
+// Removal swaps the last asteroid into the hole, so order is not preserved.
+// Storage is allocated up front for a fixed capacity.
+class AsteroidField {
+public:
+    explicit AsteroidField(std::size_t capacity);
+
+    // Bulk spawn; stops early when full. Returns how many were added, and
+    // writes their ids to outIds when it is not null.
+    std::size_t spawn(const AsteroidSpawn* spawns, std::size_t spawnCount, AsteroidId* outIds = nullptr);
+    // Scatters asteroids across the world with a fixed-seed generator
+    std::size_t spawnRandom(std::size_t spawnCount, const sf::Vector2f& worldSize, std::uint32_t seed);
+    bool despawn(AsteroidId id);
+    // Bulk despawn by dense index (ascending, unique)
+    void despawnSorted(const std::uint32_t* indices, std::size_t indexCount);
+    void clear();
+
+    // Moves every asteroid, wrapping around the world edges
+    void update(float deltaTime, const sf::Vector2f& worldSize);
+    // Same for the asteroids in [begin, end), so ranges can run on separate threads
+    void updateRange(std::size_t begin, std::size_t end, float deltaTime, const sf::Vector2f& worldSize);
+    // One point of damage per hit; destroys asteroids at zero health.
+    // Returns how many were destroyed.
+    std::size_t applyHits(const std::vector<CollisionPair>& hits);
+
+    std::size_t size() const;
+    std::size_t capacity() const;
+    std::size_t getDestroyedCount() const;
+
+    // Snapshots: the live asteroids' components in dense order. Loading
+    // restores that order exactly but hands out fresh ids, so ids taken
+    // before it stop resolving. Returns false if `count` doesn't fit or the
+    // input runs short.
+    void saveArrays(StateBuffer& out) const;
+    bool loadArrays(StateReader& in, std::size_t count, std::size_t destroyed);
+    static std::size_t savedBytes(std::size_t count); // What saveArrays() writes for `count` asteroids
+    AsteroidId idAt(std::size_t index) const;
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+    std::size_t indexOf(AsteroidId id) const;
+    bool isAlive(AsteroidId id) const;
+
+    // Packed component arrays, [0, size()) in use
+    const float* positionsX() const { return posX.data(); }
+    const float* positionsY() const { return posY.data(); }
+    const float* previousPositionsX() const { return prevX.data(); }
+    const float* previousPositionsY() const { return prevY.data(); }
+    const float* velocitiesX() const { return velX.data(); }
+    const float* velocitiesY() const { return velY.data(); }
+    const float* radii() const { return radius.data(); }
+    const float* healths() const { return health.data(); }
+    const std::uint32_t* colors() const { return color.data(); }
+    CollisionBodies bodies() const;
+
+private:
+    void removeAt(std::size_t index);
+
+    std::size_t count;
+    std::size_t freeCount;
+    std::size_t destroyedCount;
+
+    // Dense components
+    std::vector<float> posX;
+    std::vector<float> posY;
+    std::vector<float> prevX; // Position before the last update, for interpolation
+    std::vector<float> prevY;
+    std::vector<float> velX;
+    std::vector<float> velY;
+    std::vector<float> radius;
+    std::vector<float> health;
+    std::vector<std::uint32_t> color;
+    std::vector<std::uint32_t> slotOf; // Dense index -> slot
+
+    // Sparse slot table
+    std::vector<std::uint32_t> denseIndex;
+    std::vector<std::uint32_t> generation;
+    std::vector<std::uint32_t> freeSlots;
+    std::vector<std::uint32_t> damaged; // Scratch for applyHits
+};
+
+#endif
@@ -0,0 +1,16 @@
+#ifndef ASTEROID_RENDERER_HPP
+#define ASTEROID_RENDERER_HPP
+
+struct RenderBodies;
+class RenderQueue;
+class SpriteAtlas;
+
+// Queues every asteroid as one command: a quad each with the atlas' white
+// disc, tinted by the asteroid's color
+class AsteroidRenderer {
+public:
+    // alpha blends the previous and current simulation tick
+    void draw(RenderQueue& queue, const SpriteAtlas& atlas, const RenderBodies& asteroids, float alpha);
+};
+
+#endif
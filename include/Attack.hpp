@@ -1,26 +1,36 @@
 #ifndef ATTACK_HPP
 #define ATTACK_HPP
 
-#include <SFML/Graphics.hpp>
+#include "ProjectileStore.hpp"
+
 #include <SFML/System/Vector2.hpp>
 
-// Standard C++ includes
-#include <vector>
+#include <cstdint>
+
+class JobSystem;
+class StateBuffer;
+class StateReader;
 
-struct Projectile {
-    sf::CircleShape shape;
-    sf::Vector2f velocity;
+// Attack's own fields, for snapshots; the projectiles are saved separately
+struct AttackState {
+    bool attackActive;
+    float shootCooldown;
+    float shootTimer;
+    float projectileSpeed;
+    float projectileSize;
+    float worldWidth;
+    float worldHeight;
 };
 
 class Attack {
 public:
     Attack();
-    Attack(float projectileSize, float shootCooldown, float projectileSpeed, float screenWidth, float screenHeight);
+    Attack(float projectileSize, float shootCooldown, float projectileSpeed, float worldWidth, float worldHeight);
     void update(float deltaTime, const sf::Vector2f& playerPos, float playerAngle, bool attackActive);
-    void draw(sf::RenderWindow& window);
+    ProjectileHandle fire(const sf::Vector2f& position, float angleDegrees); // Spawns one projectile now
     void setAttackActive(bool active);
     bool isAttackActive() const;
-    void setScreenSize(sf::Vector2u size);
+    void setWorldSize(const sf::Vector2f& size); // Projectiles outside [0, size] are culled
 
     // Getters for debug controls
     float getProjectileSize() const;
@@ -32,18 +42,36 @@ public:
     void setShootCooldown(float cooldown);
     void setProjectileSpeed(float speed);
 
-    const std::vector<Projectile>& getProjectiles() const;
+    // Rebuilds the projectile pool, dropping all live projectiles
+    void setProjectilePool(std::size_t capacity, PoolOverflowPolicy policy);
+
+    // Removes projectiles by dense index (ascending, unique), e.g. after hits
+    void retireProjectiles(const std::uint32_t* indices, std::size_t count);
+
+    const ProjectileStore& getProjectiles() const;
+    // Every fire() since construction; not part of AttackState, so it keeps
+    // counting across loads (effects diff it to find new shots)
+    std::uint64_t getShotsFired() const;
+
+    AttackState getState() const;
+    void setState(const AttackState& state);
+    // Replaces the live projectiles with `count` saved by ProjectileStore::saveArrays()
+    bool loadProjectiles(StateReader& in, std::size_t count);
+
+    // Splits the projectile update across this pool (null runs it inline)
+    void setJobSystem(JobSystem* jobs);
 
 private:
-    std::vector<Projectile> projectiles;
+    ProjectileStore projectiles;
+    JobSystem* jobSystem;
+    std::uint64_t shotsFired;
     bool attackActive;
     float shootCooldown;
     float shootTimer;
     float projectileSpeed;
     float projectileSize;
-    float screenWidth;
-    float screenHeight;
-    sf::Vector2u screenSize;
+    float worldWidth;
+    float worldHeight;
 };
 
 #endif
@@ -0,0 +1,29 @@
+#ifndef CAMERA_HPP
+#define CAMERA_HPP
+
+#include <SFML/System/Vector2.hpp>
+
+// Keeps a target in view in a world that may be larger than the screen. The
+// view never shows past the world's edges; along an axis where the world is
+// smaller than the view, it stays centred on the world instead.
+class Camera {
+public:
+    Camera();
+
+    void setWorldSize(const sf::Vector2f& size);
+    void setViewSize(const sf::Vector2f& size); // In world units, normally the window size
+    void follow(const sf::Vector2f& target);
+
+    sf::Vector2f getCenter() const;
+    sf::Vector2f getViewSize() const;
+    sf::Vector2f getTopLeft() const;
+
+private:
+    float clampAxis(float target, float viewExtent, float worldExtent) const;
+
+    sf::Vector2f worldSize;
+    sf::Vector2f viewSize;
+    sf::Vector2f center;
+};
+
+#endif
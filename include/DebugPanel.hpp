@@ -3,39 +3,62 @@
 
 #include <SFML/Graphics.hpp>
 #include "DebugWindow.hpp"
+#include "RenderQueue.hpp"
 
 #include <vector>
 #include <string>
+#include <string_view>
 #include <functional>
 #include <memory>
 
 class Player;
 class Attack;
 
+// Retained HUD: line texts are kept between frames and only re-laid-out when
+// their string changes (checked against the sf::Text itself, so no copy),
+// and the compass rings and labels are built once. Per frame, only the two
+// needles are recomputed.
 class DebugPanel {
 public:
     DebugPanel();
-    void setFont(const sf::Font& font);
+    void setFont(const sf::Font& font); // Not copied: must outlive the panel
     void setPosition(const sf::Vector2f& pos);
     void setLineSpacing(float spacing);
-    void clear();
-    void addLine(const std::string& line);
-    void draw(sf::RenderWindow& window);
-    void drawCompass(sf::RenderWindow& window, float angleDegrees);
-    void drawCenterCompass(sf::RenderWindow& window, const sf::Vector2f& playerPos, const sf::Vector2f& centerPos);
+    void clear(); // Starts the next frame's lines; keeps the laid-out texts
+    void addLine(std::string_view line); // Copied; may point into frame arena memory
+    void setCompasses(float headingDegrees, const sf::Vector2f& playerPos, const sf::Vector2f& centerPos);
+    // Draws the texts, and queues the compass geometry on the overlay layer
+    void draw(sf::RenderWindow& window, RenderQueue& overlay);
+    unsigned int getRelayoutCount() const { return relayoutCount; } // Lines whose text changed, ever
+    unsigned int getTextDrawCalls() const { return textDrawCalls; }  // Issued by the last draw()
 
     // Debug window functions
-    void createDebugWindow();
-    void updateDebugWindow(Player& player, Attack& attack);
+    void createDebugWindow(const sf::Font& font);
+    void updateDebugWindow(Player& player, Attack& attack, const DebugStats& stats, FrameArena& arena);
     bool hasDebugWindow() const { return debugWindow != nullptr && debugWindow->isOpen(); }
     void closeDebugWindow();
+    TimeControl takeDebugTimeControl(); // Nothing when the window is closed
 
 private:
-    std::vector<std::string> lines;
-    sf::Font font;
+    void layout(); // Positions texts and rebuilds the static compass geometry
+
+    std::vector<sf::Text> texts; // Each keeps its line's text, to compare the next frame's against
+    std::size_t lineCount;
+    const sf::Font* font;
     sf::Vector2f position;
     float lineSpacing;
     unsigned int fontSize;
+    bool layoutDirty;
+    unsigned int relayoutCount;
+    unsigned int textDrawCalls;
+
+    // Compasses: rings are static, needles are rewritten every frame
+    sf::Vector2f compassCenters[2];
+    float needleAngles[2]; // Radians, 0 pointing right
+    sf::VertexArray compassRings;
+    sf::VertexArray compassNeedles;
+    sf::Text northLabel;
+    sf::Text centerLabel;
     
     // Debug window
     std::unique_ptr<DebugWindow> debugWindow;
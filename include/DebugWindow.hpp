@@ -1,5 +1,10 @@
 #pragma once
+#include "FrameArena.hpp"
+#include "FramePacer.hpp"
+#include "ResourceCache.hpp"
+#include "SimulationHistory.hpp"
 #include <SFML/Graphics.hpp>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -7,22 +12,57 @@
 class Player;
 class Attack;
 
+// Per-frame numbers from outside the simulation, shown alongside its state
+struct DebugStats {
+    unsigned int drawCalls = 0;
+    std::size_t renderCommands = 0;
+    std::size_t asteroids = 0;
+    std::size_t asteroidsDestroyed = 0;
+    std::size_t projectilesDrawn = 0; // Left after view culling
+    std::size_t asteroidsDrawn = 0;
+    std::size_t visibleChunks = 0;
+    std::size_t worldChunks = 0;
+    std::size_t particles = 0;     // Live, both blend modes
+    float particleUpdateMs = 0.f;  // Simulating them, on the render thread
+    FrameArenaStats frameArena;
+    bool renderThreaded = false;
+    float mainFrameMs = 0.f;   // Main loop: input, simulation and snapshot
+    float renderFrameMs = 0.f; // Drawing and display, on whichever thread renders
+    std::uint64_t simulatedFrames = 0;
+    std::uint64_t renderedFrames = 0;
+    std::uint64_t droppedTicks = 0; // Simulation backlog dropped when a frame hit its step limit
+    unsigned int hudRelayouts = 0; // HUD lines re-laid-out because their text changed
+    PacingStats pacing;
+    ResourceCacheStats resources;
+    SimulationHistoryStats history;
+    std::uint64_t tick = 0;       // Simulation tick on screen
+    bool rewinding = false;       // Live play frozen on the history
+    bool rewindAvailable = false; // Off while a session is recorded or replayed
+};
+
+// Rewind controls typed into the debug window since they were last taken
+struct TimeControl {
+    bool toggleRewind = false; // Freeze live play, or resume it from the tick on screen
+    int stepTicks = 0;         // Negative steps back
+    int stepSeconds = 0;
+};
+
 class DebugWindow {
 public:
     DebugWindow();
     ~DebugWindow();
 
-    void create();
+    void create(const sf::Font& font); // Not copied: only share it with main-thread text
     bool isOpen() const;
     void close();
-    void update(Player& player, Attack& attack);
+    void update(Player& player, Attack& attack, const DebugStats& stats, FrameArena& arena); // Text is built in the arena
     void processEvents();
     void render();
-    void loadFont(); // Load font from file
+    TimeControl takeTimeControl(); // And resets it
 
 private:
     bool m_isOpen = false;
+    TimeControl timeControl;
     std::unique_ptr<sf::RenderWindow> window;
-    sf::Font font;
     sf::Text m_text;
 };
\ No newline at end of file
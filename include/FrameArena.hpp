@@ -0,0 +1,82 @@
+#ifndef FRAME_ARENA_HPP
+#define FRAME_ARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+struct FrameArenaStats {
+    std::size_t capacityBytes = 0;
+    std::size_t lastFrameBytes = 0; // Used by the frame before the last reset()
+    std::size_t highWaterBytes = 0; // Most any frame has used
+    std::uint64_t overflows = 0;    // Allocations that didn't fit and went to the heap, ever
+};
+
+// Linear allocator for data that only lives for one frame. allocate() bumps
+// an offset into one block and reset(), at the top of each frame, frees it
+// all at once. An allocation that doesn't fit falls back to the heap and is
+// counted; the next reset() then grows the block to the high-water mark, so
+// a steady frame never touches the global allocator.
+class FrameArena {
+public:
+    explicit FrameArena(std::size_t capacity);
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    void* allocate(std::size_t size, std::size_t alignment);
+    template <typename T>
+    T* allocateArray(std::size_t count) {
+        return static_cast<T*>(allocate(count * sizeof(T), alignof(T)));
+    }
+
+    // Invalidates everything allocated since the last reset
+    void reset();
+
+    std::size_t getUsedBytes() const; // This frame so far, overflow included
+    FrameArenaStats getStats() const;
+
+private:
+    std::unique_ptr<unsigned char[]> block;
+    std::size_t capacity;
+    std::size_t offset;
+    std::vector<std::unique_ptr<unsigned char[]>> overflowBlocks; // Freed by reset()
+    std::size_t overflowBytes;
+    FrameArenaStats stats;
+};
+
+// Standard allocator over a FrameArena, for containers that die with the
+// frame. deallocate() is a no-op, so reserve() up front: a growing container
+// leaves its old buffers behind until the reset.
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(FrameArena& arena) : arena(&arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.getArena()) {}
+
+    T* allocate(std::size_t count) { return arena->allocateArray<T>(count); }
+    void deallocate(T*, std::size_t) {}
+
+    FrameArena* getArena() const { return arena; }
+
+private:
+    FrameArena* arena;
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+    return a.getArena() == b.getArena();
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+    return !(a == b);
+}
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef FRAME_PACER_HPP
+#define FRAME_PACER_HPP
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+// Measured pacing error over the recorded history
+struct PacingStats {
+    float targetMs = 0.f;       // 0 when unlimited
+    float p50DeviationMs = 0.f; // |frame interval - target|
+    float p99DeviationMs = 0.f;
+    std::uint64_t missedFrames = 0; // Frames that started after their deadline
+    std::size_t samples = 0;
+};
+
+// Holds a loop to a fixed frame rate. Each frame gets an absolute deadline,
+// so sleep error never accumulates. Most of the slack is slept away, and the
+// last fraction of a millisecond is spun, because OS sleeps wake up late by a
+// varying amount. The spin margin adapts to how late sleeps actually wake.
+class FramePacer {
+public:
+    static constexpr std::size_t HISTORY_FRAMES = 240;
+
+    FramePacer();
+    void setTargetRate(float hz); // 0 disables waiting (and measuring)
+    float getTargetRate() const;
+
+    void reset(); // Forget the schedule, e.g. after the loop was paused
+    void waitForNextFrame(); // Call once per frame, after the frame's work
+    PacingStats getStats() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void record(Clock::time_point frameStart);
+
+    float targetRate;
+    Clock::duration period;
+    Clock::time_point nextDeadline;
+    Clock::time_point lastFrameStart;
+    bool scheduled;
+    float spinMarginUs;   // Time before the deadline where sleeping stops
+    float oversleepAvgUs; // Running average of how late sleeps wake up
+
+    std::array<float, HISTORY_FRAMES> deviationHistoryMs;
+    std::size_t historyHead; // Next ring slot to write
+    std::size_t historyCount;
+    std::uint64_t missedFrames;
+};
+
+#endif
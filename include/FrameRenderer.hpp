@@ -0,0 +1,64 @@
+#ifndef FRAME_RENDERER_HPP
+#define FRAME_RENDERER_HPP
+
+#include "RenderSnapshot.hpp"
+#include "WorldRenderer.hpp"
+#include "AsteroidRenderer.hpp"
+#include "ParticleEffects.hpp"
+#include "ParticleRenderer.hpp"
+#include "DebugPanel.hpp"
+#include "ProfilerOverlay.hpp"
+#include "RenderQueue.hpp"
+#include "SpriteAtlas.hpp"
+
+#include <SFML/Graphics.hpp>
+
+#include <atomic>
+#include <chrono>
+
+// Draws and presents one RenderSnapshot. Owns every renderer, so whichever
+// thread calls render() is the only one touching them. The counters are
+// atomics so the main thread can read them while rendering runs elsewhere.
+// Particles are purely visual, so they live here too: spawned from each
+// snapshot's effect events and advanced by real frame time. Renderers queue
+// their geometry instead of drawing it, so a frame is a handful of batched
+// draw calls (plus the HUD texts) however many entities are on screen.
+class FrameRenderer {
+public:
+    FrameRenderer(ProfilerOverlay& profilerOverlay);
+    void setFont(const sf::Font& font); // Drawn with on the render thread, so give it a font of its own
+    void render(sf::RenderWindow& window, const RenderSnapshot& snapshot);
+
+    unsigned int getDrawCalls() const;      // Issued by the last render(), texts included
+    std::size_t getRenderCommands() const; // Queued by the last render(), before batching
+    float getLastFrameMs() const; // Time spent in the last render(), display included
+    std::uint64_t getFramesRendered() const;
+    unsigned int getHudRelayouts() const;
+    std::size_t getLiveParticles() const;
+    float getParticleUpdateMs() const;
+
+private:
+    void updateParticles(const RenderSnapshot& snapshot, float deltaTime);
+
+    WorldRenderer worldRenderer;
+    AsteroidRenderer asteroidRenderer;
+    ParticleEffects particleEffects;
+    ParticleRenderer particleRenderer;
+    std::chrono::steady_clock::time_point lastRenderTime;
+    DebugPanel hudPanel;
+    ProfilerOverlay& profilerOverlay;
+    SpriteAtlas atlas;
+    bool atlasReady;
+    RenderQueue worldQueue;   // Through the camera
+    RenderQueue overlayQueue; // In window pixels
+
+    std::atomic<unsigned int> drawCalls;
+    std::atomic<std::size_t> renderCommands;
+    std::atomic<float> lastFrameMs;
+    std::atomic<std::uint64_t> framesRendered;
+    std::atomic<unsigned int> hudRelayouts;
+    std::atomic<std::size_t> liveParticles;
+    std::atomic<float> particleUpdateMs;
+};
+
+#endif
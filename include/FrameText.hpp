@@ -0,0 +1,42 @@
+#ifndef FRAME_TEXT_HPP
+#define FRAME_TEXT_HPP
+
+#include "FrameArena.hpp"
+
+#include <charconv>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+
+// Builds one string in FrameArena memory. Numbers go through std::to_chars,
+// so nothing here allocates or reads the locale. Text past the capacity is
+// cut off. The result stays valid until the arena is reset.
+class FrameText {
+public:
+    static constexpr int DEFAULT_DECIMALS = 2;
+
+    FrameText(FrameArena& arena, std::size_t capacity);
+
+    FrameText& operator<<(std::string_view text);
+    FrameText& operator<<(const char* text) { return *this << std::string_view(text); }
+    FrameText& operator<<(char c);
+    FrameText& operator<<(float value) { return fixed(value, DEFAULT_DECIMALS); }
+    template <typename T, typename = std::enable_if_t<std::is_integral<T>::value>>
+    FrameText& operator<<(T value) {
+        return advance(std::to_chars(cursor, end, value));
+    }
+
+    FrameText& fixed(float value, int decimals);
+
+    std::string_view view() const { return std::string_view(begin, static_cast<std::size_t>(cursor - begin)); }
+    const char* c_str() const { return begin; }
+
+private:
+    FrameText& advance(const std::to_chars_result& written);
+
+    char* begin;
+    char* cursor;
+    char* end; // One before the block's end, which is kept for the terminator
+};
+
+#endif
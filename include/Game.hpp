@@ -1,16 +1,35 @@
 #ifndef GAME_HPP
 #define GAME_HPP
 
-#include "Player.hpp"
-#include "Attack.hpp"
+#include "Simulation.hpp"
 #include "InputHandler.hpp"
 #include "DebugPanel.hpp"
+#include "ProfilerOverlay.hpp"
+#include "FrameRenderer.hpp"
+#include "RenderThread.hpp"
+#include "JobSystem.hpp"
+#include "FramePacer.hpp"
+#include "ResourceCache.hpp"
+#include "AssetPack.hpp"
+#include "InputRecording.hpp"
+#include "SimulationHistory.hpp"
+#include "Camera.hpp"
+#include "WorldChunks.hpp"
+#include "FrameArena.hpp"
 
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/System/Vector2.hpp>
 
+// Fallback when there's no asset pack; CMake points it at the source tree
+#ifndef GAME_ASSET_DIR
+#define GAME_ASSET_DIR "../assets"
+#endif
+
+#include <cstdint>
+#include <memory>
 #include <vector>
 #include <string>
 
@@ -21,8 +40,8 @@ public:
     bool isRunning() const;
     void stop();
     void togglePause();
-    void renderPauseMenu(sf::RenderWindow& window, sf::Font& font, const std::vector<std::string>& items, int selected);
-    void renderSettingsMenu(sf::RenderWindow& window, sf::Font& font, const std::vector<std::string>& items, int selected);
+    void renderPauseMenu(sf::RenderTarget& target, const sf::Font& font, const std::vector<std::string>& items, int selected);
+    void renderSettingsMenu(sf::RenderTarget& target, const sf::Font& font, const std::vector<std::string>& items, int selected);
     void handleInput(sf::RenderWindow& window);
     sf::Vector2u getWindowSize(const sf::RenderWindow& window) const;
     void applyFullscreen(sf::RenderWindow& window, bool borderless);
@@ -30,27 +49,89 @@ public:
     // Add getters for Player and Attack references
     Player& getPlayer();
     Attack& getAttack();
+    Simulation& getSimulation();
     
     // Debug window control
     void toggleDebugWindow();
 
+    // World size in pixels; the window shows the part around the ship. Moves
+    // the ship to the middle, so set it before spawning anything.
+    void setWorldSize(const sf::Vector2f& size);
+
+    // Simulation timing
+    void setTickRate(float hz);
+    void setTimeScale(float scale);
+    void setMaxStepsPerFrame(int steps);
+    float getTickRate() const;
+    float getTimeScale() const;
+
+    // Threads for the job system, including the main thread; 0 means one per core
+    void setThreadCount(std::size_t threads);
+    std::size_t getThreadCount() const;
+
+    // Draw on a separate render thread (default) or inline on the main thread
+    void setRenderThreadEnabled(bool enabled);
+
+    // Maps the asset pack found next to the executable; without one, assets
+    // are loaded from the source tree's assets directory
+    void openAssetPack(const std::string& executablePath);
+
+    // Session capture: record every tick's input to a file, or play a
+    // recording back in place of the keyboard. loadReplay also sets the tick
+    // rate, world and asteroids the recording started from.
+    void setRecordPath(const std::string& path);
+    bool loadReplay(const std::string& path);
+    bool hasReplayDiverged() const;
+
+    // Frame pacing: a target rate in Hz (0 = unlimited) and/or display vsync
+    void setFrameRateLimit(float hz);
+    void setVsyncEnabled(bool enabled);
+
 private:
     void handleWindowEvents(sf::RenderWindow& window);
-    float handleRotation(float deltaTime);
-    void handleMovement(float deltaTime);
-    void handleAttack(sf::RenderWindow& window, float deltaTime, float rotationApplied);
-    void render(sf::RenderWindow& window);
+    void handleWindowEvent(sf::RenderWindow& window, const sf::Event& event);
+    void presentMenu(sf::RenderWindow& window, const sf::Font& font);
+    void waitForMenuEvent(sf::RenderWindow& window);
+    void fillSnapshot(RenderSnapshot& snapshot, const sf::RenderWindow& window, float alpha);
+    template <typename Bodies>
+    std::size_t gatherVisible(const Bodies& bodies, WorldChunks& chunks, const sf::Vector2f& worldSize,
+                              const sf::Vector2f& viewMin, const sf::Vector2f& viewMax, RenderBodies& out);
+    void present(sf::RenderWindow& window, float alpha);
     void updateDebugWindow();
+    void stepSimulation(float tickDelta);
+    void applyTimeControl(const TimeControl& control);
+    void finishSession(); // Saves the recording and reports the replay result
 
     bool running;
-    Player player;
-    Attack attack;
+    Simulation simulation;
     InputHandler inputHandler;
-    bool attackToggle;
     bool paused;
     float pauseInputCooldown;
     float pauseMenuInputCooldown; // Cooldown for pause menu input
+    AssetPack assetPack; // Cached fonts point into it, so it outlives the cache
+    ResourceCache resources;
+    FontHandle uiFont;     // Main thread: menus and debug window
+    FontHandle renderFont; // Same face, own instance for the HUD and profiler on the render thread
     DebugPanel debugPanel;
+    ProfilerOverlay profilerOverlay;
+    FrameRenderer frameRenderer;
+    RenderThread renderThread; // After frameRenderer, so it stops before the renderers go away
+    bool renderThreadEnabled;
+    FrameArena frameArena; // Reset at the top of every run() iteration; holds that frame's HUD and debug text
+
+    // View culling: bodies are bucketed into world chunks every frame, and
+    // only those in chunks near the camera go into the snapshot
+    Camera camera;
+    WorldChunks projectileChunks;
+    WorldChunks asteroidChunks;
+    std::vector<std::uint32_t> visibleIndices; // Scratch for chunk queries
+    std::size_t projectilesDrawn;
+    std::size_t asteroidsDrawn;
+    std::size_t visibleChunks; // Projectile and asteroid chunks looked at
+    std::uint64_t frameCount;
+    float lastMainFrameMs; // Main loop work, excluding the pacing wait
+    FramePacer framePacer;
+    bool vsyncEnabled;
     bool inSettingsMenu; // Flag to check if in settings menu
     int settingsMenuSelectedIndex; // Index for settings menu selection
     std::vector<std::string> pauseMenuItems = {"Resume", "Settings", "Exit"};
@@ -60,10 +141,40 @@ private:
         "Back"
     };
     int pauseMenuIndex = 0; // Index for pause menu selection
+
+    // Idle menus: drawn into menuCache only when they change, and the window
+    // sleeps between events instead of redrawing every iteration
+    sf::RenderTexture menuCache;
+    bool menuDirty;       // Menu contents changed since menuCache was drawn
+    bool menuNeedsBlit;   // Window needs menuCache copied in (resize, focus, first show)
+    sf::Clock menuBlitClock;
     std::string windowTitle = "2D SFML Game"; // Store window title here
     
     // Debug window controls
     float debugWindowToggleCooldown = 0.0f;
+
+    // Fixed-timestep simulation
+    float tickRate;             // Simulation ticks per second
+    float timeScale;            // Simulated seconds per real second
+    int maxStepsPerFrame;       // Ticks allowed per frame at 1x before the backlog is dropped; scaled with timeScale
+    float tickAccumulator;      // Scaled time not yet simulated
+    std::uint64_t droppedTicks = 0; // Backlog thrown away by frames at their step limit
+
+    std::unique_ptr<JobSystem> jobSystem;
+
+    std::string recordPath;
+    std::unique_ptr<InputRecorder> recorder;
+    std::unique_ptr<ReplayInput> replay;
+
+    // The last few seconds of play, always recorded, for the debug window's
+    // rewind and step controls
+    SimulationHistory history;
+    bool rewinding; // Live play frozen on a tick from the history
+
+    // Particle triggers gathered over the ticks since the last snapshot
+    EffectEvents pendingEffects;
+    std::uint64_t lastShotsFired;
+    bool snapshotSkipped; // The render thread never saw the last snapshot, so its events carry over
 };
 
 #endif
@@ -0,0 +1,40 @@
+#ifndef HEADLESS_HPP
+#define HEADLESS_HPP
+
+#include "InputSource.hpp"
+#include "Simulation.hpp"
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Deterministic stand-in for a player: fires continuously while circling
+// and thrusting in bursts, so the projectile pool stays busy.
+class ScriptedInput : public InputSource {
+public:
+    explicit ScriptedInput(float tickRate);
+    TickInput nextTick() override;
+
+private:
+    float tickRate;
+    std::uint64_t tick;
+};
+
+struct HeadlessOptions {
+    std::uint64_t ticks = 100000;
+    float tickRate = 120.f;
+    sf::Vector2f worldSize = sf::Vector2f(SESSION_WORLD_WIDTH, SESSION_WORLD_HEIGHT);
+    std::size_t asteroids = 0;
+    std::size_t threads = 0; // Including the main thread; 0 means one per core
+    std::string recordPath;  // Save the scripted session here
+    std::string replayPath;  // Replay this recording instead of the script
+};
+
+// Steps the simulation as fast as possible with no window or GL context and
+// prints throughput to stdout. Returns a process exit code; a replay that
+// diverges from its recorded checksums fails.
+int runHeadless(const HeadlessOptions& options);
+
+#endif
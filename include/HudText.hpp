@@ -0,0 +1,18 @@
+#ifndef HUD_TEXT_HPP
+#define HUD_TEXT_HPP
+
+#include "FrameArena.hpp"
+
+#include <SFML/System/Vector2.hpp>
+
+#include <string_view>
+
+class Player;
+
+// Formats the on-screen debug panel lines. Kept free of SFML graphics so it
+// can be benchmarked headless. Replaces the contents of `lines`; the text
+// lives in `arena` until its next reset.
+void buildHudLines(const Player& player, const sf::Vector2f& worldCenter, float tickRate, float timeScale,
+                   FrameArena& arena, ArenaVector<std::string_view>& lines);
+
+#endif
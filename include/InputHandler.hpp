@@ -1,13 +1,54 @@
 #ifndef INPUT_HANDLER_HPP
 #define INPUT_HANDLER_HPP
 
+#include "InputSource.hpp"
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/Window/Event.hpp>
 #include <SFML/Window/Keyboard.hpp>
 
-class InputHandler {
+#include <array>
+#include <bitset>
+#include <cstdint>
+
+// What the player can do, independent of which keys are bound to it
+enum class InputAction {
+    RotateLeft,
+    RotateRight,
+    MoveForward,
+    FastRotate,
+    ToggleAttack,
+    Pause,
+    MenuUp,
+    MenuDown,
+    MenuSelect,
+    ToggleDebugWindow,
+    ToggleProfiler,
+    Count
+};
+
+// Keyboard state built from the window's event stream instead of polling the
+// OS. Events are fed in as they're drained (handleEvent), and update() then
+// latches them into this frame's edges, so a press and release inside one
+// frame is still seen as a press. Actions map onto up to two keys each.
+class InputHandler : public InputSource {
 public:
+    static constexpr std::size_t BINDINGS_PER_ACTION = 2;
+
     InputHandler();
 
-    void update();
+    void handleEvent(const sf::Event& event); // Key and focus events; others are ignored
+    void update(); // Once per frame, after the events are drained
+    TickInput nextTick() override;
+    void discardAttackToggle(); // Drop a latched toggle no tick will consume, e.g. Space in a menu
+
+    // Action mapping
+    void bind(InputAction action, sf::Keyboard::Key key, std::size_t slot = 0);
+    bool isHeld(InputAction action) const;
+    bool wasPressed(InputAction action) const;  // Went down since the last frame
+    bool wasReleased(InputAction action) const; // Went up since the last frame
+    std::int64_t getPressTimeUs(InputAction action) const; // Latest press among its keys; -1 if never
+
     bool isRotateLeft() const;
     bool isRotateRight() const;
     bool isMoveForward() const;
@@ -15,6 +56,7 @@ public:
     bool wasAttackJustPressed() const;
     bool isFastRotateLeft() const;
     bool isFastRotateRight() const;
+    // Held, or tapped since the last frame
     bool isPausePressed() const;
     bool isMenuUp() const;
     bool isMenuDown() const;
@@ -22,19 +64,25 @@ public:
 
     // Debug controls
     bool isDebugWindowToggled() const;
+    bool isProfilerToggled() const;
 
 private:
-    bool rotateLeft;
-    bool rotateRight;
-    bool moveForward;
-    bool attackToggle;
-    bool prevSpacePressed;
-    bool fastRotateLeft;
-    bool fastRotateRight;
+    using KeySet = std::bitset<sf::Keyboard::KeyCount>;
 
-    // Debug controls
-    bool debugWindowToggle;
-    bool prevF1Pressed;
+    bool anyKey(InputAction action, const KeySet& keys) const;
+    bool isActive(InputAction action) const; // Held or tapped
+
+    KeySet down;            // Held right now
+    KeySet pendingPressed;  // Edges since the last update()
+    KeySet pendingReleased;
+    KeySet pressed;         // Edges latched for this frame
+    KeySet released;
+    std::array<std::int64_t, sf::Keyboard::KeyCount> pressTimeUs; // When each key last went down
+    sf::Clock clock;
+
+    std::array<std::array<sf::Keyboard::Key, BINDINGS_PER_ACTION>, static_cast<std::size_t>(InputAction::Count)> bindings;
+
+    bool attackTogglePending; // Toggle press waiting for the next tick
 };
 
 #endif
@@ -0,0 +1,90 @@
+#ifndef INPUT_RECORDING_HPP
+#define INPUT_RECORDING_HPP
+
+#include "InputSource.hpp"
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Simulation;
+
+// Hash of the simulation state a replay must reproduce exactly: the player,
+// auto-fire, every projectile and every asteroid. Walks all live bodies, so
+// it costs about as much as a cheap update pass.
+std::uint32_t simulationChecksum(const Simulation& simulation);
+
+// Recording file layout (native endianness):
+//   RecordingHeader
+//   per tick: flags byte (TickInput bits, plus TICK_WORLD_RESIZED),
+//             2 floats of world size if TICK_WORLD_RESIZED,
+//             uint32 checksum of the state after the tick
+// Ticks are fixed-length in time, so the tick delta is stored once.
+struct RecordingHeader {
+    char magic[4];
+    std::uint32_t version;
+    float tickRate;
+    float worldWidth;  // Size the simulation was created and seeded with
+    float worldHeight;
+    std::uint32_t asteroids; // Spawned from the fixed seed before the first tick
+    std::uint64_t tickCount;
+    float playerStartX; // Version 2 on; version 1 always started at the world's centre
+    float playerStartY;
+};
+
+// Captures the input fed to each simulation tick, in memory until save()
+class InputRecorder {
+public:
+    InputRecorder(float tickRate, const sf::Vector2f& worldSize, const sf::Vector2f& playerStart, std::uint32_t asteroids);
+
+    // worldSize is the one in effect during the tick; checksum is taken after it
+    void record(const TickInput& input, const sf::Vector2f& worldSize, std::uint32_t checksum);
+    bool save(const std::string& path) const;
+    std::uint64_t getTickCount() const;
+
+private:
+    RecordingHeader header;
+    std::vector<std::uint8_t> ticks;
+    sf::Vector2f lastWorldSize;
+};
+
+// Feeds a recording back in as the simulation's input, and checks that each
+// tick lands on the recorded state
+class ReplayInput : public InputSource {
+public:
+    ReplayInput();
+    bool load(const std::string& path, std::string& error);
+
+    float getTickRate() const;
+    sf::Vector2f getInitialWorldSize() const;
+    sf::Vector2f getPlayerStart() const;
+    std::uint32_t getAsteroidCount() const;
+    std::uint64_t getTickCount() const;
+
+    bool isFinished() const;
+    TickInput nextTick() override; // Empty input once finished
+    sf::Vector2f getWorldSize() const; // For the tick nextTick() last returned
+
+    // Compares the state after the tick nextTick() last returned. Returns
+    // false on a mismatch; the first one is remembered.
+    bool verify(std::uint32_t checksum);
+    bool hasDiverged() const;
+    std::uint64_t getDivergedTick() const;
+
+private:
+    struct Tick {
+        TickInput input;
+        sf::Vector2f worldSize;
+        std::uint32_t checksum;
+    };
+
+    RecordingHeader header;
+    std::vector<Tick> ticks;
+    std::uint64_t next; // Index of the tick nextTick() returns next
+    bool diverged;
+    std::uint64_t divergedTick;
+};
+
+#endif
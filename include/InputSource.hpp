@@ -0,0 +1,23 @@
+#ifndef INPUT_SOURCE_HPP
+#define INPUT_SOURCE_HPP
+
+// Player commands for one simulation tick
+struct TickInput {
+    bool rotateLeft = false;
+    bool rotateRight = false;
+    bool fastRotate = false;   // Modifies rotateLeft/rotateRight
+    bool moveForward = false;
+    bool toggleAttack = false; // Edge: flips auto-fire on or off
+};
+
+// Anything that can drive the simulation: the keyboard, a script, a replay...
+class InputSource {
+public:
+    virtual ~InputSource() = default;
+
+    // Called once per simulation tick. Edge inputs must be reported exactly
+    // once, however many ticks run per frame.
+    virtual TickInput nextTick() = 0;
+};
+
+#endif
@@ -0,0 +1,128 @@
+#ifndef JOB_SYSTEM_HPP
+#define JOB_SYSTEM_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class JobSystem;
+
+// Counts unfinished jobs. Jobs submitted with a dependency on a counter only
+// become runnable once it reaches zero.
+class JobCounter {
+public:
+    JobCounter() : pending(0), continuationCount(0) {}
+    bool isDone() const { return pending.load(std::memory_order_acquire) == 0; }
+
+private:
+    friend class JobSystem;
+    static constexpr std::size_t MAX_CONTINUATIONS = 8;
+
+    struct Continuation {
+        void (*run)(void*, std::size_t, std::size_t);
+        void* context;
+        JobCounter* counter;
+    };
+
+    std::atomic<int> pending;
+    std::mutex continuationMutex;
+    Continuation continuations[MAX_CONTINUATIONS];
+    std::size_t continuationCount;
+};
+
+// Work-stealing thread pool. Every thread (the caller counts as worker 0)
+// owns a deque: it pushes and pops at the back, and idle threads steal from
+// the front of the others. Deques are fixed-size rings, so submitting never
+// allocates; a full deque runs the job inline instead.
+//
+// Jobs take a context pointer, which must stay valid until the job's counter
+// is waited on. Jobs may submit and wait themselves (waiting runs other jobs
+// meanwhile), but only the creating thread and the pool's workers may use it.
+class JobSystem {
+public:
+    explicit JobSystem(std::size_t threadCount); // Including the caller; 0 means one per core
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    std::size_t getThreadCount() const;
+
+    // Runs fn() on a worker; `counter` is released when it finishes. With a
+    // dependency, the job is held back until that counter is done.
+    template <typename Fn>
+    void submit(JobCounter& counter, Fn& fn, JobCounter* dependency = nullptr) {
+        submitRaw(&invokeTask<Fn>, &fn, 0, 0, counter, dependency);
+    }
+
+    // Calls fn(begin, end) over [0, count) in chunks of `grain` indices and
+    // blocks until all are done. Chunk boundaries depend only on count and
+    // grain, never on the thread count, so per-chunk results are reproducible.
+    template <typename Fn>
+    void parallelFor(std::size_t count, std::size_t grain, Fn& fn) {
+        if (count == 0) return;
+        grain = grain > 0 ? grain : 1;
+        if (count <= grain || workers.empty()) {
+            for (std::size_t begin = 0; begin < count; begin += grain) {
+                fn(begin, begin + grain < count ? begin + grain : count);
+            }
+            return;
+        }
+        JobCounter counter;
+        for (std::size_t begin = 0; begin < count; begin += grain) {
+            submitRaw(&invokeRange<Fn>, &fn, begin, begin + grain < count ? begin + grain : count, counter, nullptr);
+        }
+        wait(counter);
+    }
+
+    // Helps run jobs until the counter reaches zero
+    void wait(JobCounter& counter);
+
+private:
+    struct Job {
+        void (*run)(void*, std::size_t, std::size_t);
+        void* context;
+        std::size_t begin;
+        std::size_t end;
+        JobCounter* counter;
+    };
+
+    struct WorkerQueue {
+        static constexpr std::size_t CAPACITY = 4096;
+        std::mutex mutex;
+        Job jobs[CAPACITY];
+        std::size_t head = 0; // Index of the oldest job
+        std::size_t size = 0;
+
+        bool pushBack(const Job& job);
+        bool popBack(Job& job);
+        bool popFront(Job& job);
+    };
+
+    template <typename Fn>
+    static void invokeTask(void* context, std::size_t, std::size_t) { (*static_cast<Fn*>(context))(); }
+    template <typename Fn>
+    static void invokeRange(void* context, std::size_t begin, std::size_t end) { (*static_cast<Fn*>(context))(begin, end); }
+
+    void submitRaw(void (*run)(void*, std::size_t, std::size_t), void* context, std::size_t begin, std::size_t end,
+                   JobCounter& counter, JobCounter* dependency);
+    void push(const Job& job);
+    void execute(const Job& job);
+    bool tryRunOne(std::size_t self);
+    std::size_t ownQueue() const; // The calling thread's deque in this pool
+    void workerLoop(std::size_t self);
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues; // One per thread, [0] is the caller
+    std::vector<std::thread> workers;
+    std::atomic<std::size_t> nextQueue; // Round-robin target for submissions
+    std::atomic<int> queuedJobs;
+    std::atomic<bool> stopping;
+    std::mutex sleepMutex;
+    std::condition_variable wakeUp;
+};
+
+#endif
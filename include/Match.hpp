@@ -0,0 +1,66 @@
+#ifndef MATCH_HPP
+#define MATCH_HPP
+
+#include "Player.hpp"
+#include "Attack.hpp"
+#include "InputSource.hpp"
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class JobSystem;
+
+// One ship in a match: its own Player and Attack, flown by one client
+struct MatchShip {
+    Player player;
+    Attack attack;
+    bool attackToggle;
+    bool active;
+    std::uint32_t incarnation; // Bumped each time the slot gets a new ship
+    TickInput input; // Applied on the next step
+
+    MatchShip();
+};
+
+// A multi-ship world for the dedicated server. Every ship follows the same
+// rules as the single-player Simulation (see ShipControl). Ships are kept in
+// fixed slots, so a ship's id is its index and never changes while it plays.
+class Match {
+public:
+    static constexpr std::size_t DEFAULT_PROJECTILES_PER_SHIP = 512;
+
+    Match(const sf::Vector2f& worldSize, std::size_t maxShips,
+          std::size_t projectilesPerShip = DEFAULT_PROJECTILES_PER_SHIP);
+
+    // Takes a free slot and spawns a ship in it; returns -1 when full
+    int addShip();
+    void removeShip(std::size_t id);
+    void setInput(std::size_t id, const TickInput& input);
+
+    void step(float tickDelta);
+
+    // Ships are stepped in parallel on this pool (null runs them inline)
+    void setJobSystem(JobSystem* jobs);
+
+    std::size_t getShipCapacity() const;
+    std::size_t getShipCount() const;
+    const MatchShip& getShip(std::size_t id) const;
+    sf::Vector2f getWorldSize() const;
+    std::uint64_t getTickCount() const;
+
+private:
+    void stepShips(std::size_t begin, std::size_t end, float tickDelta);
+    sf::Vector2f spawnPoint(std::size_t id) const;
+
+    sf::Vector2f worldSize;
+    std::size_t projectilesPerShip;
+    std::vector<MatchShip> ships;
+    std::size_t shipCount;
+    std::uint64_t tickCount;
+    JobSystem* jobSystem;
+};
+
+#endif
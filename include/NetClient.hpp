@@ -0,0 +1,96 @@
+#ifndef NET_CLIENT_HPP
+#define NET_CLIENT_HPP
+
+#include "NetProtocol.hpp"
+#include "Player.hpp"
+
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+#include <SFML/System/Time.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct NetClientStats {
+    std::uint64_t bytesSent = 0;
+    std::uint64_t bytesReceived = 0;
+    std::uint64_t snapshotsReceived = 0;
+    std::uint64_t fullSnapshots = 0;     // Decoded without a baseline
+    std::uint64_t staleSnapshots = 0;    // Older than one already applied
+    std::uint64_t undecodableSnapshots = 0; // Baseline no longer held, or malformed
+    std::uint64_t reassembledSnapshots = 0; // Arrived in several fragments
+    std::uint64_t rejectedSnapshots = 0;    // Too big for the server to send at all
+    std::uint64_t corrections = 0;       // Snapshots that moved the predicted ship
+    float lastPredictionError = 0.f;     // px the predicted ship moved on the last snapshot
+    float maxPredictionError = 0.f;
+    double totalPredictionError = 0.0;   // Sum over snapshots, for an average
+    std::uint16_t serverTickUs = 0;      // Reported in the newest snapshot
+};
+
+// Client side of NetServer. Sends one input per tick and predicts the local
+// ship with the same ShipControl rules the server runs, so the player sees
+// their own input immediately. When a snapshot arrives the predicted ship is
+// reset to the server's state and the inputs the server hasn't applied yet
+// are replayed on top. The other ships and all projectiles are shown as the
+// newest snapshot has them.
+class NetClient {
+public:
+    NetClient();
+
+    // Handshakes with the server, blocking for at most `timeout`
+    bool connect(const sf::IpAddress& address, unsigned short port, sf::Time timeout);
+    void disconnect();
+    bool isConnected() const;
+
+    void receive(); // Drains the socket; call once per tick before sendInput
+    void sendInput(const TickInput& input); // Predicts one tick and sends it
+
+    std::uint8_t getShipId() const;
+    float getTickRate() const;
+    sf::Vector2f getWorldSize() const;
+    const Player& getPredictedPlayer() const;
+    const NetWorldState& getWorldState() const; // Newest snapshot
+    NetClientStats getStats() const;
+    void resetStats();
+
+private:
+    static constexpr std::size_t INPUT_HISTORY = 128;
+
+    void handleSnapshot(NetReader& reader);
+    void applySnapshot(std::uint32_t tick, std::uint32_t baselineTick, std::uint32_t lastAppliedSeq,
+                       std::uint16_t serverTickUs, NetReader& delta);
+    void reconcile(const NetShipState& ship, std::uint32_t lastAppliedSeq);
+    void send(const std::vector<std::uint8_t>& data);
+
+    sf::UdpSocket socket;
+    sf::IpAddress serverAddress;
+    unsigned short serverPort;
+    bool connected;
+    std::uint8_t shipId;
+    float tickRate;
+    sf::Vector2f worldSize;
+
+    Player predicted;
+    bool predicting; // Set once a snapshot has placed the predicted ship
+    std::uint32_t nextInputSeq;
+    std::array<TickInput, INPUT_HISTORY> inputHistory; // By seq % INPUT_HISTORY
+
+    std::array<NetWorldState, NET_SNAPSHOT_HISTORY> states; // By tick % NET_SNAPSHOT_HISTORY
+    std::uint32_t newestTick;
+    NetWorldState emptyState;
+
+    // The one fragmented snapshot being put back together
+    std::uint32_t fragmentTick;
+    std::size_t fragmentCount;
+    std::uint64_t fragmentsMissing; // Bit per fragment not yet received
+    std::size_t fragmentBytesUsed;  // Known once the last, shorter, fragment arrives
+    std::vector<std::uint8_t> fragmentBytes;
+
+    std::vector<std::uint8_t> receiveBuffer;
+    std::vector<std::uint8_t> packet;
+    NetClientStats stats;
+};
+
+#endif
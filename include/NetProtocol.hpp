@@ -0,0 +1,175 @@
+#ifndef NET_PROTOCOL_HPP
+#define NET_PROTOCOL_HPP
+
+#include "InputSource.hpp"
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class Match;
+class Player;
+
+// Wire format shared by NetServer and NetClient. Every datagram starts with
+// the protocol id and a NetMessage byte; multi-byte fields are little-endian.
+//
+//   Connect    client -> server  u8 protocol version
+//   Accept     server -> client  u8 ship id, u16 tick rate (Hz), u16 x2 world size (px), u32 server tick
+//   Reject     server -> client  u8 NetRejectReason; also sent in place of a snapshot too big to send
+//   Input      client -> server  u32 newest snapshot tick received (the ack), u32 newest input seq,
+//                                u8 count, then `count` packed inputs, newest first
+//   Snapshot   server -> client  u32 tick, u32 baseline tick, u32 last input seq applied,
+//                                u16 server tick time (us), u8 fragment index, u8 fragment count,
+//                                then the fragment's share of the world delta (encodeWorldDelta)
+//   Disconnect client -> server  (empty)
+//
+// Inputs are repeated in every packet until they are well past, so a lost
+// datagram costs nothing. Snapshots are deltas against the newest snapshot
+// the client acked, or against nothing when no usable ack exists. A delta
+// too big for one datagram is split into fragments of
+// NET_SNAPSHOT_FRAGMENT_BYTES (the last one shorter) that all repeat the
+// header; the client decodes it once every fragment has arrived.
+constexpr std::uint16_t NET_PROTOCOL_ID = 0x5347;
+constexpr std::uint8_t NET_PROTOCOL_VERSION = 2;
+constexpr unsigned short NET_DEFAULT_PORT = 40404;
+constexpr std::uint32_t NET_NO_TICK = 0xFFFFFFFFu;   // "none" for ticks and input seqs
+constexpr std::size_t NET_INPUT_REDUNDANCY = 8;      // Inputs repeated per input packet
+constexpr std::size_t NET_SNAPSHOT_HISTORY = 32;     // Ticks a snapshot stays usable as a baseline
+constexpr std::size_t NET_MAX_DATAGRAM_BYTES = 65507; // IPv4 UDP payload limit, as sf::UdpSocket::MaxDatagramSize
+constexpr std::size_t NET_SNAPSHOT_HEADER_BYTES = 19;  // Protocol id and message through the fragment count
+constexpr std::size_t NET_SNAPSHOT_FRAGMENT_BYTES = NET_MAX_DATAGRAM_BYTES - NET_SNAPSHOT_HEADER_BYTES;
+constexpr std::size_t NET_MAX_SNAPSHOT_FRAGMENTS = 64; // One bit each in the client's reassembly mask
+
+enum class NetMessage : std::uint8_t {
+    Connect = 1,
+    Accept,
+    Reject,
+    Input,
+    Snapshot,
+    Disconnect
+};
+
+enum class NetRejectReason : std::uint8_t {
+    ServerFull = 1,
+    BadVersion,
+    SnapshotTooLarge // Even fragmented; the client keeps its last snapshot and waits for the next
+};
+
+// Quantization. Ship positions are 1/8 px and ship velocity 1/8 px/s.
+// Projectiles are fixed point with 8 more fractional bits, velocity in those
+// units per tick, so extrapolating one from a baseline is exact integer
+// maths that the server and every client evaluate identically.
+constexpr float NET_POSITION_SCALE = 8.f;
+constexpr float NET_VELOCITY_SCALE = 8.f;
+constexpr int NET_PROJECTILE_FRACTION_BITS = 8;
+
+// Ship flag bits
+constexpr std::uint8_t NET_SHIP_ATTACKING = 1 << 0;
+
+struct NetShipState {
+    std::uint8_t id = 0;
+    std::int32_t x = 0;
+    std::int32_t y = 0;
+    std::int32_t velocityX = 0;
+    std::int32_t velocityY = 0;
+    std::uint16_t rotation = 0; // 65536 per turn
+    std::uint8_t flags = 0;
+    std::uint32_t incarnation = 0; // Server only: bumped when the slot gets a new ship
+};
+
+struct NetProjectileState {
+    std::int32_t x; // Position units << NET_PROJECTILE_FRACTION_BITS
+    std::int32_t y;
+    std::int32_t velocityX; // Same units, per tick
+    std::int32_t velocityY;
+};
+
+// Quantized world at one tick, as both ends of the connection see it. Ships
+// are in ascending id order; ship i owns projectiles
+// [firstProjectile[i], firstProjectile[i + 1]), oldest first.
+struct NetWorldState {
+    std::uint32_t tick = NET_NO_TICK;
+    std::vector<NetShipState> ships;
+    std::vector<std::uint32_t> firstProjectile;
+    std::vector<NetProjectileState> projectiles;
+    std::vector<std::uint64_t> projectileIds; // Server only: pool handle, to match projectiles across ticks
+
+    void clear(); // Keeps capacity
+    std::size_t projectileCount(std::size_t shipIndex) const;
+    const NetShipState* findShip(std::uint8_t id) const;
+};
+
+// Growable little-endian byte writer over a caller-owned buffer
+class NetWriter {
+public:
+    explicit NetWriter(std::vector<std::uint8_t>& buffer);
+
+    void u8(std::uint8_t value);
+    void u16(std::uint16_t value);
+    void u32(std::uint32_t value);
+    void varint(std::uint64_t value); // LEB128
+    void svarint(std::int64_t value); // Zigzag, then LEB128
+    void bytes(const std::uint8_t* data, std::size_t count);
+    void header(NetMessage message);
+    std::size_t size() const;
+
+private:
+    std::vector<std::uint8_t>& buffer;
+};
+
+// Bounds-checked reader. A read past the end returns zero and leaves the
+// reader failed, so callers check ok() once after parsing.
+class NetReader {
+public:
+    NetReader(const std::uint8_t* data, std::size_t size);
+
+    std::uint8_t u8();
+    std::uint16_t u16();
+    std::uint32_t u32();
+    std::uint32_t varint();
+    std::int32_t svarint();
+    std::uint64_t varint64();
+    std::int64_t svarint64();
+    const std::uint8_t* bytes(std::size_t count); // Null if not that many remain
+    bool header(NetMessage& message); // False if the datagram isn't ours
+    bool ok() const;
+    bool atEnd() const;
+    std::size_t remaining() const;
+
+private:
+    const std::uint8_t* data;
+    std::size_t size;
+    std::size_t offset;
+    bool failed;
+};
+
+std::uint8_t packInput(const TickInput& input);
+TickInput unpackInput(std::uint8_t bits);
+
+// Quantizes every active ship and projectile of the match. A projectile that
+// was in `previous` (the last tick's capture) stays on its exact integer
+// trajectory for as long as that is within half a position unit of the real
+// one, so deltas almost never need to correct it.
+void captureWorldState(const Match& match, float tickDelta, const NetWorldState& previous, NetWorldState& out);
+
+// Puts a player where the quantized ship state says it is
+void applyShipState(const NetShipState& ship, Player& player);
+sf::Vector2f dequantizePosition(std::int32_t x, std::int32_t y);
+sf::Vector2f dequantizeProjectile(const NetProjectileState& projectile);
+
+// World delta: per ship, a mask of changed fields and their differences from
+// the baseline. Per ship's projectiles: a bitmask of which baseline
+// projectiles are still alive, a bitmask of those that didn't land where
+// their baseline velocity predicts plus the corrections, and the projectiles
+// spawned since, relative to the ship. Projectiles fly in straight lines, so
+// almost all of them cost two bits. `baseline` may be null for a full state.
+void encodeWorldDelta(const NetWorldState& current, const NetWorldState* baseline, NetWriter& out);
+
+// Rebuilds `out` from a delta; out.tick must already be set. The baseline
+// must be the exact state the delta was encoded against. False on a
+// malformed or mismatched delta.
+bool decodeWorldDelta(NetReader& in, const NetWorldState* baseline, NetWorldState& out);
+
+#endif
@@ -0,0 +1,109 @@
+#ifndef NET_SERVER_HPP
+#define NET_SERVER_HPP
+
+#include "Match.hpp"
+#include "NetProtocol.hpp"
+
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class JobSystem;
+
+struct NetServerOptions {
+    unsigned short port = NET_DEFAULT_PORT;
+    float tickRate = 60.f;
+    sf::Vector2f worldSize = sf::Vector2f(1600.f, 1200.f);
+    std::size_t maxClients = 64;
+};
+
+struct NetServerStats {
+    std::size_t clients = 0;
+    std::uint64_t ticks = 0;
+    float tickP50Ms = 0.f; // Whole server tick: receive, simulate, encode and send
+    float tickP99Ms = 0.f;
+    float tickMaxMs = 0.f;
+    std::uint64_t bytesSent = 0;
+    std::uint64_t bytesReceived = 0;
+    std::uint64_t snapshotsSent = 0;
+    std::uint64_t fullSnapshotsSent = 0; // No usable baseline
+    std::uint64_t fragmentedSnapshots = 0; // Split over several datagrams
+    std::uint64_t oversizedSnapshots = 0; // Too big even for NET_MAX_SNAPSHOT_FRAGMENTS; rejected instead
+    std::uint64_t deltasEncoded = 0; // Distinct bodies; clients on the same baseline share one
+};
+
+// Authoritative dedicated server. Owns the Match; clients only send inputs.
+// Each tick it drains the socket, applies one buffered input per client,
+// steps the match, and sends every client a snapshot delta-compressed
+// against the newest snapshot that client acknowledged. Non-blocking; the
+// caller paces tick() at the tick rate.
+class NetServer {
+public:
+    explicit NetServer(const NetServerOptions& options);
+
+    bool start(); // Binds the port
+    void tick();
+
+    void setJobSystem(JobSystem* jobs);
+    NetServerStats getStats() const;
+    const Match& getMatch() const;
+
+private:
+    static constexpr std::size_t INPUT_BUFFER = 64;
+    static constexpr std::size_t TICK_HISTORY = 600;
+
+    struct Client {
+        bool connected = false;
+        sf::IpAddress address;
+        unsigned short port = 0;
+        std::uint32_t ackedTick = NET_NO_TICK;
+        std::uint32_t newestInputSeq = NET_NO_TICK; // Newest received
+        std::uint32_t nextInputSeq = 0;             // Next to apply
+        std::uint32_t lastAppliedSeq = NET_NO_TICK;
+        std::array<std::uint32_t, INPUT_BUFFER> inputSeqs;
+        std::array<TickInput, INPUT_BUFFER> inputs;
+        bool toggleCarried = false; // A toggle press from an input that was skipped
+        std::uint64_t lastHeardTick = 0;
+    };
+
+    // Snapshot body for one baseline, shared by every client acking it
+    struct EncodedDelta {
+        std::uint32_t baselineTick;
+        std::vector<std::uint8_t> bytes;
+    };
+
+    void receivePackets();
+    void handlePacket(const std::uint8_t* data, std::size_t size, const sf::IpAddress& address, unsigned short port);
+    void handleConnect(NetReader& reader, const sf::IpAddress& address, unsigned short port);
+    void handleInput(Client& client, NetReader& reader);
+    Client* findClient(const sf::IpAddress& address, unsigned short port, std::size_t& id);
+    void applyInputs();
+    void dropSilentClients();
+    void sendSnapshots();
+    const std::vector<std::uint8_t>& deltaFor(std::uint32_t baselineTick);
+    void send(const std::vector<std::uint8_t>& packet, const sf::IpAddress& address, unsigned short port);
+
+    NetServerOptions options;
+    float tickDelta;
+    Match match;
+    sf::UdpSocket socket;
+    std::vector<Client> clients; // Indexed by ship id
+
+    std::array<NetWorldState, NET_SNAPSHOT_HISTORY> history; // By tick % NET_SNAPSHOT_HISTORY
+    std::vector<EncodedDelta> deltaCache; // This tick's bodies
+    std::size_t deltaCacheUsed;
+    std::vector<std::uint8_t> receiveBuffer;
+    std::vector<std::uint8_t> packet;
+
+    std::array<float, TICK_HISTORY> tickHistoryMs;
+    std::size_t tickHistoryHead;
+    std::size_t tickHistoryCount;
+    std::uint16_t lastTickUs;
+    NetServerStats stats;
+};
+
+#endif
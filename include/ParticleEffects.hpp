@@ -0,0 +1,42 @@
+#ifndef PARTICLE_EFFECTS_HPP
+#define PARTICLE_EFFECTS_HPP
+
+#include "ParticleSystem.hpp"
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+// The game's particle emitters: an engine plume attached to the ship, a
+// flash at its nose for every shot, and sparks where projectiles hit. Glowing
+// particles go to one pool that is drawn additively and smoke and dust to one
+// that is alpha blended, so each blend mode is a single draw.
+class ParticleEffects {
+public:
+    ParticleEffects();
+
+    // Ship pose as drawn: rotation in degrees, 0 pointing up
+    void emitThrust(const sf::Vector2f& shipPosition, float shipRotation, float shipScale, float deltaTime);
+    void emitMuzzleFlash(const sf::Vector2f& shipPosition, float shipRotation, float shipScale, std::uint32_t shots);
+    void emitImpact(const sf::Vector2f& position);
+
+    void update(float deltaTime);
+    void clear();
+
+    const ParticleSystem& getAdditive() const;
+    const ParticleSystem& getAlphaBlended() const;
+    std::size_t size() const; // Live particles in both pools
+
+private:
+    float random(); // [0, 1)
+    float random(float low, float high);
+    sf::Vector2f randomVelocity(float headingDegrees, float spreadDegrees, float minSpeed, float maxSpeed);
+
+    ParticleSystem additive;
+    ParticleSystem alphaBlended;
+    std::uint32_t seed;
+    float thrustCarry; // Fraction of a particle owed to the next emitThrust()
+};
+
+#endif
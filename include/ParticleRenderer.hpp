@@ -0,0 +1,23 @@
+#ifndef PARTICLE_RENDERER_HPP
+#define PARTICLE_RENDERER_HPP
+
+#include "RenderQueue.hpp"
+
+#include <SFML/System/Vector2.hpp>
+
+class ParticleEffects;
+class ParticleSystem;
+
+// Queues ParticleEffects as points: one command per blend mode, with each
+// particle's alpha scaled by its fade
+class ParticleRenderer {
+public:
+    // Particles outside [viewMin, viewMax] are left out
+    void draw(RenderQueue& queue, const ParticleEffects& effects, const sf::Vector2f& viewMin, const sf::Vector2f& viewMax);
+
+private:
+    void drawPool(RenderQueue& queue, const ParticleSystem& particles, RenderBlend blend,
+                  const sf::Vector2f& viewMin, const sf::Vector2f& viewMax);
+};
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef PARTICLE_SYSTEM_HPP
+#define PARTICLE_SYSTEM_HPP
+
+#include "ProjectileKernels.hpp" // SimdLevel
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Fixed-capacity structure-of-arrays pool of short-lived, purely visual
+// particles. Nothing here feeds back into the simulation, so order is not
+// kept: dead particles are swapped out with the last live one. All storage
+// is allocated up front; spawns past capacity are refused and counted.
+class ParticleSystem {
+public:
+    explicit ParticleSystem(std::size_t capacity);
+
+    // Velocity lost per second, as a fraction (0 keeps it, 1 stops it dead)
+    void setDrag(float drag);
+
+    bool spawn(const sf::Vector2f& position, const sf::Vector2f& velocity, float lifetime, std::uint32_t color);
+    void clear();
+
+    // Moves every particle, ages it and recomputes its fade (1 at birth, 0 at
+    // the end of its lifetime), then drops the ones that reached 0
+    void update(float deltaTime);
+    // Same, forcing a specific path. Levels above detectSimdLevel() fall back to it.
+    void update(SimdLevel level, float deltaTime);
+
+    std::size_t size() const;
+    std::size_t capacity() const;
+    std::size_t getRefusedCount() const;
+
+    // Live particles are [0, size())
+    const float* positionsX() const { return posX.data(); }
+    const float* positionsY() const { return posY.data(); }
+    const float* fades() const { return fade.data(); }
+    const std::uint32_t* colors() const { return color.data(); } // RGBA; alpha is scaled by the fade when drawn
+
+private:
+    void removeDead();
+
+    std::size_t count;
+    std::size_t refusedCount;
+    float drag;
+
+    std::vector<float> posX;
+    std::vector<float> posY;
+    std::vector<float> velX;
+    std::vector<float> velY;
+    std::vector<float> age;
+    std::vector<float> inverseLifetime;
+    std::vector<float> fade;
+    std::vector<std::uint32_t> color;
+};
+
+#endif
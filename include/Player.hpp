@@ -1,22 +1,44 @@
 #ifndef PLAYER_HPP
 #define PLAYER_HPP
 
-#include <SFML/Graphics.hpp>
+#include <SFML/System/Vector2.hpp>
+
+// Every field of a Player, for snapshots; trivially copyable
+struct PlayerState {
+    sf::Vector2f position;
+    float rotation;
+    float scale;
+    float speed;
+    float rotationSpeed;
+    float acceleration;
+    float maxSpeed;
+    float friction;
+    sf::Vector2f velocity;
+    sf::Vector2f previousPosition;
+    float previousRotation;
+};
 
 class Player {
 public:
     Player(float x, float y);
     void update(float deltaTime);
-    void draw(sf::RenderWindow& window);
     void rotate(float angle);
     void moveForward(float deltaTime);
     void handleRotation(float rotationSpeed, float deltaTime);
     sf::Vector2f getPosition() const;
     float getRotation() const;
+    sf::Vector2f getVelocity() const;
 
     void applyMovementForce(float force, float deltaTime, float angleDegrees);
     void updateMovement(float deltaTime, float force);
-    void setPosition(const sf::Vector2f& position) { shape.setPosition(position); }
+    void setPosition(const sf::Vector2f& newPosition) { position = newPosition; previousPosition = newPosition; }
+    void setVelocity(const sf::Vector2f& newVelocity) { velocity = newVelocity; }
+    void setRotation(float degrees) { rotation = degrees; previousRotation = degrees; } // Expects [0, 360)
+
+    // Render interpolation between the previous and current tick
+    void storePreviousState(); // Call at the start of every simulation tick
+    sf::Vector2f getInterpolatedPosition(float alpha) const;
+    float getInterpolatedRotation(float alpha) const;
 
     // Getters for debug controls
     float getAcceleration() const;
@@ -30,15 +52,24 @@ public:
     void setMaxSpeed(float speed);
     void setScale(float scale);
 
+    // Exact state, including tuning and the interpolation baseline
+    PlayerState getState() const;
+    void setState(const PlayerState& state);
+
 private:
-    sf::ConvexShape shape;
+    sf::Vector2f position;
+    float rotation; // Degrees in [0, 360), 0 points up
+    float scale;
     float speed;
     float rotationSpeed;
     float acceleration;
     float maxSpeed;
     float friction;
     sf::Vector2f velocity;
-    
+
+    // State at the start of the current tick, for render interpolation
+    sf::Vector2f previousPosition;
+    float previousRotation;
 };
 
 #endif
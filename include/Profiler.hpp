@@ -0,0 +1,81 @@
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+// Per-phase frame profiler. Scopes are nestable; a nested phase's time is
+// also counted in its parent. Times are summed per frame, then the last
+// HISTORY_FRAMES frames are kept in a fixed ring buffer. Main thread only.
+//
+// Instrument code with the macros below. They compile to nothing unless
+// GAME_ENABLE_PROFILER is defined (CMake defines it for non-release builds).
+class Profiler {
+public:
+    static constexpr std::size_t MAX_PHASES = 32;
+    static constexpr std::size_t HISTORY_FRAMES = 240;
+
+    struct PhaseStats {
+        const char* name;
+        int depth;     // Nesting level when the phase was first seen
+        float lastMs;
+        float minMs;
+        float avgMs;
+        float p99Ms;
+    };
+
+    static Profiler& instance();
+
+    std::size_t beginScope(const char* name); // Returns the phase index
+    void endScope(std::size_t phase, std::chrono::steady_clock::duration elapsed);
+    void nextFrame(); // Closes the current frame and starts a new one
+
+    // Stats over the recorded history, in first-seen order. Returns the count.
+    std::size_t getPhaseStats(PhaseStats* out, std::size_t maxPhases) const;
+    // Frame times in ms, oldest first. Returns the count written.
+    std::size_t getFrameHistory(float* out, std::size_t maxFrames) const;
+
+private:
+    Profiler();
+
+    std::array<const char*, MAX_PHASES> phaseNames;
+    std::array<int, MAX_PHASES> phaseDepths;
+    std::size_t phaseCount;
+    int currentDepth;
+
+    std::array<std::int64_t, MAX_PHASES> currentFrameNs;
+    std::array<std::array<float, MAX_PHASES>, HISTORY_FRAMES> phaseHistoryMs;
+    std::array<float, HISTORY_FRAMES> frameHistoryMs;
+    std::size_t historyHead;  // Next ring slot to write
+    std::size_t historyCount;
+    std::chrono::steady_clock::time_point frameStart;
+};
+
+// Times the enclosing block into the named phase
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name)
+        : phase(Profiler::instance().beginScope(name)), start(std::chrono::steady_clock::now()) {}
+    ~ProfileScope() { Profiler::instance().endScope(phase, std::chrono::steady_clock::now() - start); }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    std::size_t phase;
+    std::chrono::steady_clock::time_point start;
+};
+
+#if defined(GAME_ENABLE_PROFILER)
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(name)
+#define PROFILE_NEXT_FRAME() Profiler::instance().nextFrame()
+#else
+#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_NEXT_FRAME() ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef PROFILER_OVERLAY_HPP
+#define PROFILER_OVERLAY_HPP
+
+#include "Profiler.hpp"
+#include "RenderQueue.hpp"
+#include "RenderSnapshot.hpp"
+
+#include <SFML/Graphics.hpp>
+
+#include <array>
+#include <string>
+
+// On-screen view of the Profiler: per-phase last/min/avg/p99 times and a
+// frame-time graph, drawn in the top-right corner of the window.
+// capture() reads the profiler and must run on the thread that owns it;
+// draw() only uses the capture, so it can run on the render thread.
+class ProfilerOverlay {
+public:
+    ProfilerOverlay();
+    void setFont(const sf::Font& font);
+    void toggle();
+    bool isVisible() const;
+
+    void capture(ProfilerCapture& out);
+    // Draws the text and queues the graph on the overlay layer
+    void draw(sf::RenderWindow& window, RenderQueue& overlay, const ProfilerCapture& captured);
+
+private:
+    void buildGraph(const ProfilerCapture& captured, const sf::Vector2f& origin);
+
+    sf::Text text;
+    sf::VertexArray graph;
+    std::string textBuffer;
+    std::array<Profiler::PhaseStats, Profiler::MAX_PHASES> phaseStats;
+    bool visible;
+};
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef PROJECTILE_COLLIDER_HPP
+#define PROJECTILE_COLLIDER_HPP
+
+#include "SpatialGrid.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class JobSystem;
+class ProjectileStore;
+
+// Projectile vs target hit detection: a SpatialGrid broadphase over the
+// targets, then an exact circle test per candidate pair. Each projectile hits
+// at most one target (the lowest index it overlaps). With a job system the
+// projectiles are walked in fixed-size chunks whose hits are joined in chunk
+// order, so the result never depends on the thread count. Buffers are
+// reused, so steady-state ticks do not allocate.
+class ProjectileCollider {
+public:
+    ProjectileCollider();
+
+    void setWorldSize(const sf::Vector2f& size);
+    SpatialGrid& getGrid();
+
+    // Splits the projectile walk across this pool (null runs it inline)
+    void setJobSystem(JobSystem* jobs);
+
+    // Returns this tick's hits, ordered by projectile index
+    const std::vector<CollisionPair>& detect(const ProjectileStore& projectiles, const CollisionBodies& targets);
+
+    // detect() in two halves, so the targets can be binned on another thread
+    // while the projectiles are still moving. `padding` must cover the radius
+    // of every projectile the query will see.
+    void prepare(const CollisionBodies& targets, float padding);
+    const std::vector<CollisionPair>& query(const ProjectileStore& projectiles);
+    static float maxRadius(const ProjectileStore& projectiles);
+
+    const std::vector<CollisionPair>& getHits() const;
+    // Projectile indices of getHits(), ascending, ready for ProjectileStore::retireSorted()
+    const std::vector<std::uint32_t>& getHitProjectiles() const;
+    std::size_t getCandidateCount() const; // Pairs tested by the narrowphase last tick
+
+private:
+    // Tests projectiles [begin, end), appending their hits; returns the pairs tested
+    std::size_t queryRange(const ProjectileStore& projectiles, std::size_t begin, std::size_t end,
+                           std::vector<CollisionPair>& out) const;
+
+    SpatialGrid grid;
+    JobSystem* jobSystem;
+    std::vector<std::vector<CollisionPair>> chunkHits; // Per job chunk, joined in order
+    std::vector<std::size_t> chunkCandidates;
+    std::vector<CollisionPair> hits;
+    std::vector<std::uint32_t> hitProjectiles;
+    std::size_t targetCount; // As of the last prepare()
+    std::size_t candidateCount;
+};
+
+#endif
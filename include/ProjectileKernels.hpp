@@ -0,0 +1,37 @@
+#ifndef PROJECTILE_KERNELS_HPP
+#define PROJECTILE_KERNELS_HPP
+
+#include "ProjectileStore.hpp"
+
+#include <cstddef>
+
+class JobSystem;
+
+// Instruction sets the projectile kernels can run on, in ascending order
+enum class SimdLevel {
+    Scalar,
+    SSE2,
+    AVX2,
+    AVX512
+};
+
+// Best instruction set supported by this CPU (detected once, then cached)
+SimdLevel detectSimdLevel();
+const char* simdLevelName(SimdLevel level);
+
+// Moves every projectile by velocity * deltaTime (keeping its old position in
+// prevX/prevY for render interpolation), then compacts the ones still
+// inside [0, maxX] x [0, maxY] to the front of the arrays, preserving order.
+// The slots of culled projectiles are written to retiredSlots in order.
+// Returns the number of survivors. All SIMD paths are bit-identical to Scalar.
+std::size_t integrateAndCull(const ProjectileArrays& arrays, std::size_t count, float deltaTime, float maxX, float maxY);
+
+// Same, forcing a specific path. Levels above detectSimdLevel() fall back to it.
+std::size_t integrateAndCull(SimdLevel level, const ProjectileArrays& arrays, std::size_t count, float deltaTime, float maxX, float maxY);
+
+// Same, split into chunks of `grain` projectiles that run as jobs and are then
+// stitched back together. The result is identical for any thread count.
+std::size_t integrateAndCull(JobSystem& jobs, std::size_t grain, const ProjectileArrays& arrays, std::size_t count,
+                             float deltaTime, float maxX, float maxY);
+
+#endif
@@ -0,0 +1,144 @@
+#ifndef PROJECTILE_STORE_HPP
+#define PROJECTILE_STORE_HPP
+
+#include <SFML/System/Vector2.hpp>
+
+class StateBuffer;
+class StateReader;
+
+// Standard C++ includes
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Read-only snapshot of a single projectile, assembled from the SoA arrays
+struct ProjectileView {
+    sf::Vector2f position;
+    sf::Vector2f velocity;
+    float radius;
+    std::uint32_t color; // RGBA, same packing as sf::Color::toInteger()
+};
+
+// Stable reference to one projectile. It stops resolving once that projectile
+// is gone, even if its slot has been reused by a newer one.
+struct ProjectileHandle {
+    std::uint32_t slot = 0;
+    std::uint32_t generation = 0; // 0 is never issued, so a default handle is invalid
+
+    bool isValid() const { return generation != 0; }
+};
+
+// What add() does when every slot of the pool is in use
+enum class PoolOverflowPolicy {
+    DropOldest, // Retire the oldest projectile to make room
+    Refuse      // Keep the existing projectiles and return an invalid handle
+};
+
+// Mutable pointers to every attribute array, for kernels that rewrite them.
+// `retiredSlots` is scratch space where kernels append the slots they cull.
+struct ProjectileArrays {
+    float* posX;
+    float* posY;
+    float* prevX; // Position before the last integration step
+    float* prevY;
+    float* velX;
+    float* velY;
+    float* radius;
+    std::uint32_t* color;
+    std::uint32_t* slot;
+    std::uint32_t* retiredSlots;
+};
+
+// Fixed-capacity structure-of-arrays projectile pool. Each attribute lives in
+// its own contiguous array so the update loop only streams the data it touches,
+// and live projectiles stay packed in spawn order (index 0 is the oldest).
+// The packed range starts at a moving head with spare room behind it, so
+// dropping the oldest projectile just advances the head; the range is moved
+// back to the front only once that room runs out.
+// All storage is allocated up front; nothing allocates after construction.
+class ProjectileStore {
+public:
+    explicit ProjectileStore(std::size_t capacity, PoolOverflowPolicy policy = PoolOverflowPolicy::DropOldest);
+
+    ProjectileHandle add(const sf::Vector2f& position, const sf::Vector2f& velocity, float radius, std::uint32_t color);
+    // Shifts whichever side of `index` is shorter, so removing the oldest is
+    // O(1); use retireSorted() to remove many at once
+    bool remove(ProjectileHandle handle);
+    void removeAt(std::size_t index);
+    void clear();
+
+    // Finishes a kernel pass that kept the first `survivors` projectiles and
+    // wrote the rest to retiredSlots
+    void commitCull(std::size_t survivors);
+
+    // Removes the projectiles at the given dense indices (ascending, unique)
+    // in one stable compaction pass
+    void retireSorted(const std::uint32_t* indices, std::size_t indexCount);
+
+    std::size_t size() const;
+    bool empty() const;
+    std::size_t capacity() const;
+    PoolOverflowPolicy getOverflowPolicy() const;
+    std::size_t getDroppedCount() const;  // Retired by DropOldest
+    std::size_t getRefusedCount() const;  // Rejected by Refuse
+    ProjectileView operator[](std::size_t index) const;
+
+    // Handle lookups. indexOf() returns npos for stale handles.
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+    ProjectileHandle handleAt(std::size_t index) const;
+    std::size_t indexOf(ProjectileHandle handle) const;
+    bool isAlive(ProjectileHandle handle) const;
+
+    // Snapshots: writes the live projectiles' attributes, oldest first, and
+    // loads them back. Loading hands out fresh slots, so handles taken before
+    // it stop resolving; the diagnostic counters are left alone. Returns false
+    // if `count` doesn't fit or the input runs short.
+    void saveArrays(StateBuffer& out) const;
+    bool loadArrays(StateReader& in, std::size_t count);
+    static std::size_t savedBytes(std::size_t count); // What saveArrays() writes for `count` projectiles
+
+    // Raw attribute arrays for bulk processing
+    ProjectileArrays arrays();
+    const float* positionsX() const { return posX.data() + head; }
+    const float* positionsY() const { return posY.data() + head; }
+    const float* previousPositionsX() const { return prevX.data() + head; }
+    const float* previousPositionsY() const { return prevY.data() + head; }
+    const float* velocitiesX() const { return velX.data() + head; }
+    const float* velocitiesY() const { return velY.data() + head; }
+    const float* radii() const { return radius.data() + head; }
+    const std::uint32_t* colors() const { return color.data() + head; }
+
+private:
+    std::uint32_t acquireSlot();
+    void releaseSlot(std::uint32_t slot);
+    void bumpGeneration(std::uint32_t slot);
+    // Moves storage [first, last) to start at `to`, keeping denseIndex in step
+    void moveRange(std::size_t first, std::size_t last, std::size_t to);
+
+    std::size_t poolCapacity;
+    std::size_t head; // Storage index of the oldest projectile
+    std::size_t count;
+    std::size_t freeCount;
+    PoolOverflowPolicy overflowPolicy;
+    std::size_t droppedCount;
+    std::size_t refusedCount;
+
+    // Dense per-projectile attributes, [head, head + count) in use
+    std::vector<float> posX;
+    std::vector<float> posY;
+    std::vector<float> prevX;
+    std::vector<float> prevY;
+    std::vector<float> velX;
+    std::vector<float> velY;
+    std::vector<float> radius;
+    std::vector<std::uint32_t> color;
+    std::vector<std::uint32_t> slotOf; // Dense index -> slot
+
+    // Sparse per-slot bookkeeping
+    std::vector<std::uint32_t> denseIndex; // Slot -> storage index
+    std::vector<std::uint32_t> generation;
+    std::vector<std::uint32_t> freeSlots;  // Stack of unused slots
+    std::vector<std::uint32_t> retiredSlots;
+};
+
+#endif
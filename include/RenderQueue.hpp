@@ -0,0 +1,76 @@
+#ifndef RENDER_QUEUE_HPP
+#define RENDER_QUEUE_HPP
+
+#include <SFML/Graphics.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Draw order between layers is fixed; inside a layer the queue may reorder
+// commands to batch them
+enum class RenderLayer : std::uint8_t {
+    World,   // Asteroids, projectiles, the ship
+    Effects, // Particles, over the world
+    Overlay, // HUD geometry, in window pixels
+};
+
+enum class RenderBlend : std::uint8_t {
+    Alpha,
+    Add,
+};
+
+// Collects a frame's geometry as commands, each a run of vertices plus the
+// state it needs, then sorts them by (layer, blend, texture, primitive) and
+// draws every run of matching state with a single call. Commands that only
+// differ in submission order keep it, so a renderer can still layer its own
+// geometry inside a layer. Only list primitives (points, lines, triangles,
+// quads) are accepted, since those are the ones that can be concatenated.
+// Vertex storage is kept between frames, so steady frames don't allocate.
+class RenderQueue {
+public:
+    RenderQueue();
+
+    void clear();
+
+    // Appends a command and returns its `vertexCount` vertices to fill. The
+    // pointer is only good until the next push().
+    sf::Vertex* push(RenderLayer layer, sf::PrimitiveType primitive, const sf::Texture* texture, RenderBlend blend,
+                     std::size_t vertexCount);
+    void push(RenderLayer layer, const sf::VertexArray& vertices, const sf::Texture* texture = nullptr,
+              RenderBlend blend = RenderBlend::Alpha);
+    // Gives back the unused tail of the last push(), e.g. after culling
+    void shrinkLast(std::size_t vertexCount);
+
+    // Draws everything with the target's current view and empties the queue
+    void submit(sf::RenderTarget& target);
+
+    unsigned int getDrawCalls() const;    // Issued by the last submit()
+    std::size_t getCommandCount() const;  // Merged by the last submit()
+
+private:
+    struct Command {
+        std::uint64_t key;
+        std::uint32_t firstVertex;
+        std::uint32_t vertexCount;
+        const sf::Texture* texture;
+        sf::PrimitiveType primitive;
+        RenderBlend blend;
+    };
+
+    static constexpr std::size_t MAX_TEXTURES = 255; // Ids fit 8 bits; 0 is "untextured"
+
+    std::uint64_t textureId(const sf::Texture* texture);
+    void draw(sf::RenderTarget& target, std::size_t first, std::size_t end);
+
+    std::vector<Command> commands;
+    std::vector<sf::Vertex> vertices;
+    std::vector<sf::Vertex> gathered; // A batch whose commands weren't adjacent in `vertices`
+    std::array<const sf::Texture*, MAX_TEXTURES> textures;
+    std::size_t textureCount;
+    unsigned int drawCalls;
+    std::size_t commandCount;
+};
+
+#endif
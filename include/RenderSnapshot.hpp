@@ -0,0 +1,90 @@
+#ifndef RENDER_SNAPSHOT_HPP
+#define RENDER_SNAPSHOT_HPP
+
+#include "Profiler.hpp"
+
+#include <SFML/System/Vector2.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Previous and current positions of a set of circles, for interpolated drawing
+struct RenderBodies {
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> prevX;
+    std::vector<float> prevY;
+    std::vector<float> radius;
+    std::vector<std::uint32_t> color;
+    std::size_t count = 0;
+
+    // Sizes every array once, so copyFrom() never allocates
+    void reserve(std::size_t capacity);
+    void copyFrom(const float* curX, const float* curY, const float* previousX, const float* previousY,
+                  const float* radii, const std::uint32_t* colors, std::size_t bodyCount);
+    // Copies only the bodies at `indices`, e.g. the visible ones
+    void gatherFrom(const float* curX, const float* curY, const float* previousX, const float* previousY,
+                    const float* radii, const std::uint32_t* colors, const std::uint32_t* indices, std::size_t indexCount);
+};
+
+// Profiler overlay contents, captured on the thread that owns the profiler
+struct ProfilerCapture {
+    static constexpr std::size_t TEXT_CAPACITY = 2048;
+
+    bool visible = false;
+    std::array<char, TEXT_CAPACITY> text{};
+    std::array<float, Profiler::HISTORY_FRAMES> frameTimes{};
+    std::size_t frameCount = 0;
+};
+
+// Gameplay moments that spawn particles on the render thread. They describe
+// what happened since the previous snapshot, so a snapshot the renderer never
+// saw hands its events on to the next one instead of dropping them.
+struct EffectEvents {
+    static constexpr std::size_t MAX_IMPACTS = 256; // More in one frame just aren't shown
+
+    bool thrusting = false;
+    std::uint32_t shots = 0;
+    std::array<sf::Vector2f, MAX_IMPACTS> impacts{};
+    std::size_t impactCount = 0;
+
+    void clear();
+    void addImpact(const sf::Vector2f& position);
+};
+
+// Everything needed to draw one frame, copied out of the simulation so the
+// render thread never touches live game state. Fixed-size HUD text and
+// pre-reserved arrays keep filling a snapshot allocation-free.
+struct RenderSnapshot {
+    static constexpr std::size_t MAX_HUD_LINES = 8;
+    static constexpr std::size_t HUD_LINE_CAPACITY = 96;
+
+    std::uint64_t frame = 0;
+    float alpha = 0.f; // Blend between previous and current tick
+
+    // Ship, already interpolated for drawing
+    sf::Vector2f playerDrawPosition;
+    float playerDrawRotation = 0.f;
+    float playerScale = 1.f;
+    // Latest tick's state, for the HUD compasses
+    sf::Vector2f playerPosition;
+    float playerRotation = 0.f;
+    sf::Vector2f worldCenter;
+
+    // Camera, in world units
+    sf::Vector2f viewCenter;
+    sf::Vector2f viewSize;
+
+    RenderBodies projectiles; // Only those near the view
+    RenderBodies asteroids;
+    EffectEvents effects;
+
+    std::array<std::array<char, HUD_LINE_CAPACITY>, MAX_HUD_LINES> hudLines{};
+    std::size_t hudLineCount = 0;
+
+    ProfilerCapture profiler;
+};
+
+#endif
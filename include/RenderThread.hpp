@@ -0,0 +1,52 @@
+#ifndef RENDER_THREAD_HPP
+#define RENDER_THREAD_HPP
+
+#include "RenderSnapshot.hpp"
+#include "TripleBuffer.hpp"
+
+#include <SFML/Graphics/RenderWindow.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+
+class FrameRenderer;
+
+// Runs a FrameRenderer on its own thread, fed through a triple buffer of
+// RenderSnapshots: the main thread fills snapshot() and publish()es it, and
+// the render thread always draws the newest one. While running, the window's
+// GL context belongs to the render thread; events must still be polled on
+// the thread that created the window.
+class RenderThread {
+public:
+    explicit RenderThread(FrameRenderer& renderer);
+    ~RenderThread();
+
+    void reserve(std::size_t projectileCapacity, std::size_t asteroidCapacity);
+
+    void start(sf::RenderWindow& window);
+    void stop(); // Joins the thread and hands the context back to the caller
+    bool isRunning() const;
+
+    // Snapshot to fill next. When the thread is stopped, the caller may also
+    // draw it directly with the FrameRenderer.
+    RenderSnapshot& snapshot();
+    // True if the render thread skipped the previously published snapshot,
+    // which snapshot() now holds again
+    bool publish();
+
+private:
+    void loop();
+
+    FrameRenderer& renderer;
+    TripleBuffer<RenderSnapshot> snapshots;
+    sf::RenderWindow* window;
+    std::thread thread;
+    std::atomic<bool> running;
+    std::mutex wakeMutex;
+    std::condition_variable wakeUp;
+};
+
+#endif
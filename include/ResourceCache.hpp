@@ -0,0 +1,69 @@
+#ifndef RESOURCE_CACHE_HPP
+#define RESOURCE_CACHE_HPP
+
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+class AssetPack;
+
+using FontHandle = std::shared_ptr<const sf::Font>;
+using TextureHandle = std::shared_ptr<const sf::Texture>;
+
+struct ResourceCacheStats {
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0; // Each one is a load from disk
+    std::size_t entries = 0;
+    std::size_t residentBytes = 0; // Heap copies: font file data plus texture pixels
+    std::size_t mappedBytes = 0;   // Fonts read straight out of the asset pack
+};
+
+// Loads each asset once, keyed by name, and hands out shared handles. A
+// handle keeps its asset alive even after the cache drops it. A failed load is
+// remembered too (as a null handle), so a missing file isn't retried every
+// time. Main thread only: textures need the main GL context.
+//
+// Names are looked up in the asset pack first (case-insensitively), then as
+// files under the asset directory.
+class ResourceCache {
+public:
+    // Fonts from the pack point into its mapping, so it must outlive them
+    void setAssetPack(const AssetPack* pack);
+    void setAssetDirectory(const std::string& directory);
+
+    FontHandle getFont(const std::string& name);
+    // A separate sf::Font over the same bytes as getFont(name), for another
+    // thread: sf::Font fills its glyph pages while text is drawn, so threads
+    // can't share one. Not cached, and never reads the file again.
+    FontHandle getFontInstance(const std::string& name);
+    TextureHandle getTexture(const std::string& name);
+
+    void releaseUnused(); // Drop assets that only the cache still holds
+    ResourceCacheStats getStats() const;
+
+private:
+    struct Entry {
+        std::shared_ptr<const void> resource;
+        std::size_t bytes;
+        bool mapped; // bytes live in the pack, not on the heap
+        const void* source; // Font file bytes, owned by the pack or by `resource`
+    };
+
+    // Returns the cached entry, or nullptr on a miss
+    const Entry* find(const std::string& key);
+    std::string diskPath(const std::string& name) const;
+
+    const AssetPack* pack = nullptr;
+    std::string assetDirectory = ".";
+
+    std::unordered_map<std::string, Entry> entries;
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+};
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef SHIP_CONTROL_HPP
+#define SHIP_CONTROL_HPP
+
+#include "InputSource.hpp"
+
+#include <SFML/System/Vector2.hpp>
+
+class Player;
+class Attack;
+
+// The per-tick rules for flying one ship, shared by the single-player
+// Simulation, the networked Match, and client-side prediction, so all three
+// move a ship identically.
+
+// Turns and thrusts the ship; returns the rotation applied this tick, in degrees
+float applyShipControls(Player& player, const TickInput& input, float tickDelta);
+
+// Flips auto-fire on a toggle press and advances the ship's projectiles,
+// firing only while the ship is inside the world
+void applyShipAttack(Player& player, Attack& attack, bool& attackToggle, const TickInput& input, float tickDelta,
+                     float rotationApplied, const sf::Vector2f& worldSize);
+
+#endif
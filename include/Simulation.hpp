@@ -0,0 +1,97 @@
+#ifndef SIMULATION_HPP
+#define SIMULATION_HPP
+
+#include "Player.hpp"
+#include "Attack.hpp"
+#include "AsteroidField.hpp"
+#include "InputSource.hpp"
+#include "ProjectileCollider.hpp"
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+class JobSystem;
+class StateBuffer;
+class StateReader;
+
+// World a new session starts in unless --world= overrides it; windowed and
+// headless runs share it so their recordings are interchangeable
+constexpr float SESSION_WORLD_WIDTH = 4096.f;
+constexpr float SESSION_WORLD_HEIGHT = 4096.f;
+
+// Fixed-size head of a simulation snapshot. saveState() writes it first, then
+// the projectile and asteroid arrays, `projectileCount` and `asteroidCount`
+// elements each.
+struct SimulationState {
+    std::uint64_t tickCount;
+    sf::Vector2f worldSize;
+    PlayerState player;
+    AttackState attack;
+    bool attackToggle;
+    std::uint32_t projectileCount;
+    std::uint32_t asteroidCount;
+    std::uint64_t asteroidsDestroyed;
+};
+static_assert(std::is_trivially_copyable<SimulationState>::value, "Snapshots are copied as raw bytes");
+
+// All gameplay state and rules, with no dependency on a window or renderer.
+// Advanced in fixed ticks by whoever owns it (Game, or the headless runner).
+class Simulation {
+public:
+    explicit Simulation(const sf::Vector2f& worldSize);
+
+    void step(float tickDelta, InputSource& input);
+    void step(float tickDelta, const TickInput& input);
+
+    void setWorldSize(const sf::Vector2f& size);
+    sf::Vector2f getWorldSize() const;
+    std::uint64_t getTickCount() const;
+    bool isAttackToggled() const;
+
+    // Runs the bulk updates on this pool (null runs everything inline).
+    // Results are the same for any thread count.
+    void setJobSystem(JobSystem* jobs);
+
+    // Snapshots of all gameplay state. Stepping a loaded state with the same
+    // inputs reproduces the original ticks exactly. Projectile handles and
+    // asteroid ids taken before a load stop resolving. loadState() returns
+    // false, with the simulation untouched, if the snapshot is truncated or
+    // doesn't fit this simulation's pools.
+    void saveState(StateBuffer& out) const;
+    bool loadState(StateReader& in);
+
+    // Scatters asteroids over the world from a fixed seed; returns how many fit
+    std::size_t spawnAsteroids(std::size_t count);
+
+    // Projectile/asteroid hits from the last tick; those projectiles are
+    // already retired and the damage applied
+    const std::vector<CollisionPair>& getHits() const;
+    // Where those projectiles were when they hit, one per retired projectile
+    const std::vector<sf::Vector2f>& getImpacts() const;
+
+    Player& getPlayer();
+    Attack& getAttack();
+    const Player& getPlayer() const;
+    const Attack& getAttack() const;
+    AsteroidField& getAsteroids();
+    const AsteroidField& getAsteroids() const;
+
+private:
+    void resolveHits();
+    void updateAsteroids(float tickDelta);
+
+    sf::Vector2f worldSize;
+    Player player;
+    Attack attack;
+    AsteroidField asteroids;
+    ProjectileCollider collider;
+    std::vector<sf::Vector2f> impacts;
+    bool attackToggle;
+    std::uint64_t tickCount;
+    JobSystem* jobSystem;
+};
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef SIMULATION_HISTORY_HPP
+#define SIMULATION_HISTORY_HPP
+
+#include "InputSource.hpp"
+#include "StateBuffer.hpp"
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class Simulation;
+
+struct SimulationHistoryStats {
+    std::uint64_t oldestTick = 0; // Earliest tick seek() can reach
+    std::uint64_t newestTick = 0; // Tick after the last one recorded
+    std::size_t keyframes = 0;
+    std::size_t keyframeBytes = 0;
+    float lastKeyframeUs = 0.f;   // Cost of the newest keyframe capture
+    float captureUsPerTick = 0.f; // Keyframe and input capture, averaged over every recorded tick
+    float lastSeekMs = 0.f;
+    std::uint64_t lastSeekTicks = 0; // Ticks re-simulated by the last seek
+};
+
+// Rewind buffer for the last few seconds of a Simulation. Copying the whole
+// state every tick would cost tens of microseconds at 10k projectiles, so it
+// keeps a full snapshot every `keyframeInterval` ticks plus every tick's
+// input, and rebuilds any tick in between by stepping from the keyframe
+// before it. The simulation is deterministic, so that is exact.
+class SimulationHistory {
+public:
+    explicit SimulationHistory(std::size_t tickCapacity = 600, std::size_t keyframeInterval = 30);
+
+    // Resizes the window and drops everything recorded
+    void configure(std::size_t tickCapacity, std::size_t keyframeInterval);
+    void clear();
+
+    // Call just before each live step, with the input that step will use.
+    // Recording after a seek back drops the ticks that were ahead of it; a
+    // tick outside the recorded range starts a new history.
+    void record(const Simulation& simulation, const TickInput& input, float tickDelta);
+
+    // Puts the simulation at `tick`, clamped to [oldest, newest], and returns
+    // the tick it ended on. Moving forward from a tick already in the history
+    // steps from there instead of reloading. Returns the simulation's own tick
+    // unchanged if nothing is recorded or a keyframe no longer fits its pools.
+    std::uint64_t seek(Simulation& simulation, std::uint64_t tick);
+
+    bool empty() const;
+    std::uint64_t getOldestTick() const;
+    std::uint64_t getNewestTick() const;
+    SimulationHistoryStats getStats() const;
+
+private:
+    struct LoggedTick {
+        TickInput input;
+        float tickDelta;
+        sf::Vector2f worldSize; // In effect for that tick
+    };
+
+    struct Keyframe {
+        std::uint64_t tick = 0;
+        bool valid = false;
+        StateBuffer state;
+    };
+
+    Keyframe& keyframeFor(std::uint64_t tick); // The slot of the keyframe at or before `tick`
+    void replayTicks(Simulation& simulation, std::uint64_t to);
+
+    std::size_t tickCapacity;
+    std::size_t keyframeInterval;
+    std::vector<LoggedTick> ticks;   // Ring, indexed by tick
+    std::vector<Keyframe> keyframes; // Ring, indexed by keyframe number since baseTick
+    bool recording;
+    std::uint64_t baseTick; // First tick of the current history; keyframes fall every interval after it
+    std::uint64_t endTick;  // One past the last recorded tick
+
+    // Stats
+    double captureUsTotal;
+    std::uint64_t ticksRecorded;
+    float lastKeyframeUs;
+    float lastSeekMs;
+    std::uint64_t lastSeekTicks;
+};
+
+#endif
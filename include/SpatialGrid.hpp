@@ -0,0 +1,92 @@
+#ifndef SPATIAL_GRID_HPP
+#define SPATIAL_GRID_HPP
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Read-only view of a set of circles stored as parallel arrays
+struct CollisionBodies {
+    const float* x = nullptr;
+    const float* y = nullptr;
+    const float* radius = nullptr;
+    std::size_t count = 0;
+};
+
+// A target's circle as copied into a grid bucket
+struct GridEntry {
+    float x;
+    float y;
+    float radius;
+    std::uint32_t target;
+};
+
+// A projectile index paired with a target index
+struct CollisionPair {
+    std::uint32_t projectile;
+    std::uint32_t target;
+};
+
+// Uniform grid over the world that buckets targets by the cells their bounds
+// cover, inflated by a padding (the largest projectile radius). A projectile
+// then only needs to look at the one cell its center falls in.
+// Buckets are filled with a counting sort into one flat array, and the rebuild
+// is skipped entirely when no target has moved to a different set of cells.
+// Each bucket entry also carries a copy of its target's circle, refreshed
+// every update, so a query touches one contiguous run of memory per cell.
+class SpatialGrid {
+public:
+    SpatialGrid();
+
+    void setWorldSize(const sf::Vector2f& size);
+    void setCellSize(float size); // 0 or less picks a size from the target radii
+    float getCellSize() const;
+
+    // Returns true if the buckets had to be rebuilt
+    bool update(const CollisionBodies& targets, float padding);
+
+    // Cell index of a point, or -1 if it is outside the world
+    std::int32_t cellAt(float x, float y) const;
+    // Bucket entries of a cell, ordered by target index
+    const GridEntry* cellBegin(std::int32_t cell) const { return entries.data() + cellStart[cell]; }
+    const GridEntry* cellEnd(std::int32_t cell) const { return entries.data() + cellStart[cell + 1]; }
+
+    // Appends every projectile/target pair sharing a cell
+    void queryCandidates(const float* x, const float* y, std::size_t count, std::vector<CollisionPair>& out) const;
+
+    std::size_t getCellCount() const;
+    std::size_t getEntryCount() const;
+    std::size_t getRebuildCount() const;
+
+private:
+    struct CellSpan {
+        std::int32_t x0, y0, x1, y1; // Inclusive; x0 > x1 means no cells
+
+        bool operator==(const CellSpan& other) const {
+            return x0 == other.x0 && y0 == other.y0 && x1 == other.x1 && y1 == other.y1;
+        }
+        bool operator!=(const CellSpan& other) const { return !(*this == other); }
+    };
+
+    bool updateLayout(const CollisionBodies& targets, float padding);
+    CellSpan spanOf(float x, float y, float reach) const;
+    void rebuildBuckets();
+    void refreshEntries(const CollisionBodies& targets);
+
+    sf::Vector2f worldSize;
+    float requestedCellSize;
+    float cellSize;
+    float inverseCellSize;
+    std::int32_t columns;
+    std::int32_t rows;
+    std::size_t rebuildCount;
+
+    std::vector<CellSpan> spans;           // Per target, as of the last update
+    std::vector<std::uint32_t> cellStart;  // Per cell offset into entries, plus an end marker
+    std::vector<std::uint32_t> cellCursor; // Scratch for the counting sort
+    std::vector<GridEntry> entries;        // Targets grouped by cell
+};
+
+#endif
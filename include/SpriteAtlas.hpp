@@ -0,0 +1,33 @@
+#ifndef SPRITE_ATLAS_HPP
+#define SPRITE_ATLAS_HPP
+
+#include <SFML/Graphics.hpp>
+
+// One texture holding every sprite the world is drawn with, generated on the
+// CPU at startup so nothing is loaded from disk: a soft-edged disc for
+// asteroids and projectiles, and the ship's triangle. Sprites are white, to
+// be tinted by vertex color, and padded so smooth sampling never bleeds
+// between them.
+class SpriteAtlas {
+public:
+    enum class Sprite {
+        Disc,
+        Ship,
+    };
+
+    void build(); // Needs a GL context, so call it on the thread that draws
+
+    const sf::Texture& getTexture() const;
+    sf::FloatRect getRegion(Sprite sprite) const; // In texels
+    // The ship region in ship-local units: (0, 0) is the ship's origin and
+    // the triangle is the same one WorldRenderer used to draw as a shape
+    sf::FloatRect getShipBounds() const;
+
+private:
+    void bakeDisc(sf::Image& image) const;
+    void bakeShip(sf::Image& image) const;
+
+    sf::Texture texture;
+};
+
+#endif
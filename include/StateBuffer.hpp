@@ -0,0 +1,71 @@
+#ifndef STATE_BUFFER_HPP
+#define STATE_BUFFER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+// Append-only byte buffer that simulation snapshots are written into. Storage
+// is kept across clear() and never shrinks, so capturing into a reused buffer
+// is a handful of memcpys with no allocation.
+class StateBuffer {
+public:
+    void clear() { used = 0; }
+    void append(const void* data, std::size_t count);
+
+    template <typename T>
+    void write(const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "Snapshots hold raw bytes");
+        append(&value, sizeof(T));
+    }
+
+    template <typename T>
+    void writeArray(const T* values, std::size_t count) {
+        static_assert(std::is_trivially_copyable<T>::value, "Snapshots hold raw bytes");
+        append(values, count * sizeof(T));
+    }
+
+    const std::uint8_t* data() const { return bytes.data(); }
+    std::size_t size() const { return used; }
+    std::size_t capacity() const { return bytes.size(); }
+
+private:
+    std::vector<std::uint8_t> bytes; // [0, used) is the snapshot
+    std::size_t used = 0;
+};
+
+// Reads a StateBuffer back in the order it was written. A read past the end
+// leaves the destination untouched and the reader failed, so callers check
+// ok() once afterwards.
+class StateReader {
+public:
+    StateReader(const std::uint8_t* data, std::size_t size);
+    explicit StateReader(const StateBuffer& buffer);
+
+    const std::uint8_t* take(std::size_t count); // Null if not that many remain
+
+    template <typename T>
+    void read(T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "Snapshots hold raw bytes");
+        if (const std::uint8_t* source = take(sizeof(T))) std::memcpy(&value, source, sizeof(T));
+    }
+
+    template <typename T>
+    void readArray(T* values, std::size_t count) {
+        static_assert(std::is_trivially_copyable<T>::value, "Snapshots hold raw bytes");
+        if (const std::uint8_t* source = take(count * sizeof(T))) std::memcpy(values, source, count * sizeof(T));
+    }
+
+    bool ok() const { return !failed; }
+    std::size_t remaining() const { return size - offset; }
+
+private:
+    const std::uint8_t* data;
+    std::size_t size;
+    std::size_t offset;
+    bool failed;
+};
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef TRIPLE_BUFFER_HPP
+#define TRIPLE_BUFFER_HPP
+
+#include <atomic>
+#include <cstdint>
+
+// Lock-free single-producer, single-consumer triple buffer. The producer
+// fills back() and publish()es it; the consumer acquire()s the newest
+// published value into front(). Neither side ever waits for the other, and
+// the consumer skips values it was too slow to see.
+template <typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() : backIndex(0), middle(1), frontIndex(2) {}
+
+    // Producer side
+    T& back() { return slots[backIndex]; }
+    // Returns true if the value it replaced was never acquired; back() then
+    // holds that skipped value
+    bool publish() {
+        const std::uint32_t previous = middle.exchange(backIndex | FRESH_BIT, std::memory_order_acq_rel);
+        backIndex = previous & INDEX_MASK;
+        return (previous & FRESH_BIT) != 0;
+    }
+
+    // Consumer side. Returns false (and leaves front() alone) if nothing new
+    // was published since the last call.
+    bool acquire() {
+        if ((middle.load(std::memory_order_relaxed) & FRESH_BIT) == 0) return false;
+        const std::uint32_t previous = middle.exchange(frontIndex, std::memory_order_acq_rel);
+        frontIndex = previous & INDEX_MASK;
+        return true;
+    }
+    const T& front() const { return slots[frontIndex]; }
+
+    // Not thread-safe: for setting up every slot before the threads start
+    T& slot(std::uint32_t index) { return slots[index]; }
+
+private:
+    static constexpr std::uint32_t FRESH_BIT = 4;
+    static constexpr std::uint32_t INDEX_MASK = 3;
+
+    T slots[3];
+    std::uint32_t backIndex;          // Producer only
+    std::atomic<std::uint32_t> middle; // Shared slot index, plus FRESH_BIT once published
+    std::uint32_t frontIndex;         // Consumer only
+};
+
+#endif
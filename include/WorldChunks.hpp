@@ -0,0 +1,46 @@
+#ifndef WORLD_CHUNKS_HPP
+#define WORLD_CHUNKS_HPP
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Buckets a set of points into fixed-size square chunks of the world, so
+// visibility culling only looks at the chunks a view overlaps. Rebuilt from
+// scratch with a counting sort, so a build costs one pass over the points
+// plus one over the chunks; chunks are large, so there are few of them even
+// for big worlds. Buffers only grow, so steady-state builds don't allocate.
+class WorldChunks {
+public:
+    explicit WorldChunks(float chunkSize);
+
+    void setWorldSize(const sf::Vector2f& size);
+
+    // Points outside the world go into the nearest edge chunk
+    void build(const float* x, const float* y, std::size_t count);
+
+    // Appends the index of every point in a chunk overlapping the rectangle,
+    // ascending within each chunk. Returns how many chunks it looked at.
+    std::size_t query(float minX, float minY, float maxX, float maxY, std::vector<std::uint32_t>& out) const;
+
+    float getChunkSize() const;
+    std::size_t getChunkCount() const;
+
+private:
+    std::int32_t column(float x) const;
+    std::int32_t row(float y) const;
+
+    sf::Vector2f worldSize;
+    float chunkSize;
+    float inverseChunkSize;
+    std::int32_t columns;
+    std::int32_t rows;
+
+    std::vector<std::uint32_t> chunkOf;    // Per point, from the last build
+    std::vector<std::uint32_t> chunkStart; // Per chunk offset into indices, plus an end marker
+    std::vector<std::uint32_t> indices;    // Point indices grouped by chunk
+};
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef WORLD_RENDERER_HPP
+#define WORLD_RENDERER_HPP
+
+#include <SFML/Graphics.hpp>
+
+struct RenderBodies;
+class RenderQueue;
+class SpriteAtlas;
+
+// Queues simulation state from a render snapshot as atlas sprites. Keeps all
+// SFML graphics objects out of the simulation classes so they can run
+// without a window.
+class WorldRenderer {
+public:
+    // One quad with the atlas' ship sprite
+    void drawPlayer(RenderQueue& queue, const SpriteAtlas& atlas, const sf::Vector2f& position, float rotation, float scale);
+    // alpha blends the previous and current simulation tick
+    void drawProjectiles(RenderQueue& queue, const SpriteAtlas& atlas, const RenderBodies& projectiles, float alpha);
+};
+
+#endif
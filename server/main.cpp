@@ -0,0 +1,89 @@
+#include "NetServer.hpp"
+#include "FramePacer.hpp"
+#include "JobSystem.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+// Dedicated server: ./game_server [--port=N] [--tick-rate=HZ] [--max-clients=N]
+//                                 [--world=WxH] [--threads=N] [--seconds=S]
+namespace {
+    constexpr float STATS_INTERVAL_S = 5.f;
+
+    // Returns the value of "--name=value" style arguments, or nullptr
+    const char* optionValue(const std::string& arg, const std::string& name) {
+        const std::string prefix = "--" + name + "=";
+        return arg.compare(0, prefix.size(), prefix) == 0 ? arg.c_str() + prefix.size() : nullptr;
+    }
+
+    void printStats(const NetServerStats& stats, const NetServerStats& previous, float seconds) {
+        const double sentPerClient = stats.clients > 0
+            ? static_cast<double>(stats.bytesSent - previous.bytesSent) / seconds / stats.clients : 0.0;
+        std::cout << "tick " << stats.ticks << ": " << stats.clients << " clients, tick p50 " << stats.tickP50Ms
+                  << " ms, p99 " << stats.tickP99Ms << " ms, max " << stats.tickMaxMs << " ms, "
+                  << sentPerClient / 1024.0 << " KiB/s per client, "
+                  << (stats.fullSnapshotsSent - previous.fullSnapshotsSent) << " full snapshots, "
+                  << (stats.deltasEncoded - previous.deltasEncoded) << " deltas encoded";
+        if (stats.fragmentedSnapshots > previous.fragmentedSnapshots) {
+            std::cout << ", " << (stats.fragmentedSnapshots - previous.fragmentedSnapshots) << " fragmented";
+        }
+        if (stats.oversizedSnapshots > previous.oversizedSnapshots) {
+            std::cout << ", " << (stats.oversizedSnapshots - previous.oversizedSnapshots) << " OVERSIZED (rejected)";
+        }
+        std::cout << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    NetServerOptions options;
+    std::size_t threads = 1;
+    float runSeconds = 0.f; // 0 runs until killed
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (const char* value = optionValue(arg, "port")) {
+            options.port = static_cast<unsigned short>(std::atoi(value));
+        } else if (const char* value = optionValue(arg, "tick-rate")) {
+            options.tickRate = std::strtof(value, nullptr);
+        } else if (const char* value = optionValue(arg, "max-clients")) {
+            options.maxClients = std::strtoull(value, nullptr, 10);
+        } else if (const char* value = optionValue(arg, "world")) {
+            char* end = nullptr;
+            options.worldSize.x = std::strtof(value, &end);
+            options.worldSize.y = *end == 'x' ? std::strtof(end + 1, nullptr) : options.worldSize.x;
+        } else if (const char* value = optionValue(arg, "threads")) {
+            threads = std::strtoull(value, nullptr, 10);
+        } else if (const char* value = optionValue(arg, "seconds")) {
+            runSeconds = std::strtof(value, nullptr);
+        }
+    }
+    if (options.tickRate <= 0.f || options.maxClients == 0) {
+        std::cerr << "Tick rate and client limit must be positive" << std::endl;
+        return 1;
+    }
+
+    JobSystem jobs(threads);
+    NetServer server(options);
+    server.setJobSystem(&jobs);
+    if (!server.start()) {
+        return 1;
+    }
+    std::cout << "Serving up to " << options.maxClients << " clients on UDP port " << options.port << " at "
+              << options.tickRate << " Hz" << std::endl;
+
+    FramePacer pacer;
+    pacer.setTargetRate(options.tickRate);
+    const std::uint64_t statsInterval = static_cast<std::uint64_t>(STATS_INTERVAL_S * options.tickRate);
+    const std::uint64_t runTicks = static_cast<std::uint64_t>(runSeconds * options.tickRate);
+    NetServerStats previous;
+    for (std::uint64_t tick = 1; runTicks == 0 || tick <= runTicks; ++tick) {
+        server.tick();
+        if (tick % statsInterval == 0) {
+            const NetServerStats stats = server.getStats();
+            printStats(stats, previous, STATS_INTERVAL_S);
+            previous = stats;
+        }
+        pacer.waitForNextFrame();
+    }
+    return 0;
+}
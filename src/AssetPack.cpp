@@ -0,0 +1,230 @@
+#include "AssetPack.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    std::size_t alignUp(std::size_t value) {
+        return (value + ASSET_PACK_ALIGNMENT - 1) / ASSET_PACK_ALIGNMENT * ASSET_PACK_ALIGNMENT;
+    }
+
+    // Compares an entry's name with a normalized key, for the binary search
+    int compareName(const char* name, std::size_t length, const std::string& key) {
+        const int result = std::memcmp(name, key.data(), std::min(length, key.size()));
+        if (result != 0) return result;
+        return length < key.size() ? -1 : (length > key.size() ? 1 : 0);
+    }
+}
+
+AssetPack::AssetPack()
+    : base(nullptr), mappedBytes(0), entries(nullptr), entryCount(0), names(nullptr)
+#ifdef _WIN32
+      , fileHandle(nullptr), mappingHandle(nullptr)
+#endif
+{}
+
+AssetPack::~AssetPack() {
+    close();
+}
+
+bool AssetPack::open(const std::string& path) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!view) {
+        if (mapping) CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    fileHandle = file;
+    mappingHandle = mapping;
+    base = static_cast<const unsigned char*>(view);
+    mappedBytes = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        ::close(fd);
+        return false;
+    }
+    void* view = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // The mapping keeps the file alive
+    if (view == MAP_FAILED) return false;
+    base = static_cast<const unsigned char*>(view);
+    mappedBytes = static_cast<std::size_t>(info.st_size);
+#endif
+
+    // Validate everything find() will touch, so a bad pack fails here
+    AssetPackHeader header;
+    if (mappedBytes < sizeof(header)) {
+        close();
+        return false;
+    }
+    std::memcpy(&header, base, sizeof(header));
+    const std::size_t namesStart = sizeof(header) + static_cast<std::size_t>(header.entryCount) * sizeof(AssetPackEntry);
+    if (std::memcmp(header.magic, ASSET_PACK_MAGIC, sizeof(header.magic)) != 0 || header.version != ASSET_PACK_VERSION
+        || namesStart + header.namesSize > mappedBytes) {
+        close();
+        return false;
+    }
+    entries = reinterpret_cast<const AssetPackEntry*>(base + sizeof(header));
+    entryCount = header.entryCount;
+    names = reinterpret_cast<const char*>(base + namesStart);
+    for (std::size_t i = 0; i < entryCount; ++i) {
+        const AssetPackEntry& entry = entries[i];
+        if (static_cast<std::uint64_t>(entry.nameOffset) + entry.nameLength > header.namesSize
+            || entry.dataOffset > mappedBytes || entry.size > mappedBytes - entry.dataOffset) {
+            close();
+            return false;
+        }
+    }
+    return true;
+}
+
+void AssetPack::close() {
+    if (base) {
+#ifdef _WIN32
+        UnmapViewOfFile(base);
+        CloseHandle(static_cast<HANDLE>(mappingHandle));
+        CloseHandle(static_cast<HANDLE>(fileHandle));
+        mappingHandle = nullptr;
+        fileHandle = nullptr;
+#else
+        munmap(const_cast<unsigned char*>(base), mappedBytes);
+#endif
+    }
+    base = nullptr;
+    mappedBytes = 0;
+    entries = nullptr;
+    entryCount = 0;
+    names = nullptr;
+}
+
+bool AssetPack::isOpen() const {
+    return base != nullptr;
+}
+
+AssetView AssetPack::find(const std::string& name) const {
+    AssetView view;
+    if (!base) return view;
+
+    const std::string key = normalizeName(name);
+    const AssetPackEntry* end = entries + entryCount;
+    const AssetPackEntry* it = std::lower_bound(entries, end, key, [this](const AssetPackEntry& entry, const std::string& k) {
+        return compareName(names + entry.nameOffset, entry.nameLength, k) < 0;
+    });
+    if (it != end && compareName(names + it->nameOffset, it->nameLength, key) == 0) {
+        view.data = base + it->dataOffset;
+        view.size = static_cast<std::size_t>(it->size);
+    }
+    return view;
+}
+
+std::size_t AssetPack::getEntryCount() const {
+    return entryCount;
+}
+
+std::size_t AssetPack::getMappedBytes() const {
+    return mappedBytes;
+}
+
+std::string AssetPack::normalizeName(const std::string& name) {
+    std::string normalized;
+    normalized.reserve(name.size());
+    for (const char c : name) {
+        normalized.push_back(c == '\\' ? '/' : static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+    }
+    return normalized;
+}
+
+bool AssetPack::write(const std::string& outputPath, std::vector<AssetPackSource> sources, std::string& error) {
+    for (AssetPackSource& source : sources) {
+        source.name = normalizeName(source.name);
+    }
+    std::sort(sources.begin(), sources.end(), [](const AssetPackSource& a, const AssetPackSource& b) { return a.name < b.name; });
+    for (std::size_t i = 1; i < sources.size(); ++i) {
+        if (sources[i].name == sources[i - 1].name) {
+            error = "two assets normalize to the same name: " + sources[i].name;
+            return false;
+        }
+    }
+
+    std::vector<std::vector<char>> contents(sources.size());
+    for (std::size_t i = 0; i < sources.size(); ++i) {
+        std::ifstream file(sources[i].path, std::ios::binary);
+        if (!file) {
+            error = "can't read " + sources[i].path;
+            return false;
+        }
+        contents[i].assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    AssetPackHeader header;
+    std::memcpy(header.magic, ASSET_PACK_MAGIC, sizeof(header.magic));
+    header.version = ASSET_PACK_VERSION;
+    header.entryCount = static_cast<std::uint32_t>(sources.size());
+    header.namesSize = 0;
+
+    std::vector<AssetPackEntry> index(sources.size());
+    for (std::size_t i = 0; i < sources.size(); ++i) {
+        index[i].nameOffset = header.namesSize;
+        index[i].nameLength = static_cast<std::uint32_t>(sources[i].name.size());
+        header.namesSize += index[i].nameLength;
+    }
+    std::size_t offset = alignUp(sizeof(header) + index.size() * sizeof(AssetPackEntry) + header.namesSize);
+    for (std::size_t i = 0; i < sources.size(); ++i) {
+        index[i].dataOffset = offset;
+        index[i].size = contents[i].size();
+        offset = alignUp(offset + contents[i].size());
+    }
+
+    std::ofstream out(outputPath, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        error = "can't write " + outputPath;
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(index.data()), static_cast<std::streamsize>(index.size() * sizeof(AssetPackEntry)));
+    for (const AssetPackSource& source : sources) {
+        out.write(source.name.data(), static_cast<std::streamsize>(source.name.size()));
+    }
+    static const char padding[ASSET_PACK_ALIGNMENT] = {};
+    for (std::size_t i = 0; i < sources.size(); ++i) {
+        const std::size_t position = static_cast<std::size_t>(out.tellp());
+        out.write(padding, static_cast<std::streamsize>(index[i].dataOffset - position));
+        out.write(contents[i].data(), static_cast<std::streamsize>(contents[i].size()));
+    }
+    if (!out) {
+        error = "error writing " + outputPath;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,250 @@
+#include "AsteroidField.hpp"
+#include "StateBuffer.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Random asteroid parameters
+    constexpr float MIN_RADIUS = 8.0f;
+    constexpr float MAX_RADIUS = 24.0f;
+    constexpr float MIN_SPEED = 15.0f;
+    constexpr float MAX_SPEED = 60.0f;
+    constexpr float RADIUS_PER_HEALTH = 6.0f; // Bigger rocks take more hits
+    constexpr std::uint8_t MIN_SHADE = 110;
+    constexpr std::uint8_t SHADE_RANGE = 90;
+
+    constexpr float TWO_PI = 6.28318531f;
+
+    // Fixed-seed LCG returning [0, 1), so spawns repeat exactly
+    float nextRandom(std::uint32_t& state) {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<float>(state >> 8) / static_cast<float>(1u << 24);
+    }
+
+    std::uint32_t greyColor(std::uint8_t shade) {
+        return (static_cast<std::uint32_t>(shade) << 24) | (static_cast<std::uint32_t>(shade) << 16) |
+               (static_cast<std::uint32_t>(shade) << 8) | 0xFFu;
+    }
+}
+
+AsteroidField::AsteroidField(std::size_t capacity)
+    : count(0),
+      freeCount(0),
+      destroyedCount(0),
+      posX(capacity),
+      posY(capacity),
+      prevX(capacity),
+      prevY(capacity),
+      velX(capacity),
+      velY(capacity),
+      radius(capacity),
+      health(capacity),
+      color(capacity),
+      slotOf(capacity),
+      denseIndex(capacity),
+      generation(capacity, 1),
+      freeSlots(capacity)
+{
+    damaged.reserve(capacity);
+    clear();
+}
+
+std::size_t AsteroidField::spawn(const AsteroidSpawn* spawns, std::size_t spawnCount, AsteroidId* outIds) {
+    const std::size_t added = std::min(spawnCount, capacity() - count);
+    for (std::size_t i = 0; i < added; ++i) {
+        const AsteroidSpawn& s = spawns[i];
+        const std::uint32_t slot = freeSlots[--freeCount];
+        const std::size_t index = count++;
+        posX[index] = s.position.x;
+        posY[index] = s.position.y;
+        prevX[index] = s.position.x;
+        prevY[index] = s.position.y;
+        velX[index] = s.velocity.x;
+        velY[index] = s.velocity.y;
+        radius[index] = s.radius;
+        health[index] = s.health;
+        color[index] = s.color;
+        slotOf[index] = slot;
+        denseIndex[slot] = static_cast<std::uint32_t>(index);
+        if (outIds) outIds[i] = AsteroidId{slot, generation[slot]};
+    }
+    return added;
+}
+
+std::size_t AsteroidField::spawnRandom(std::size_t spawnCount, const sf::Vector2f& worldSize, std::uint32_t seed) {
+    std::vector<AsteroidSpawn> spawns(std::min(spawnCount, capacity() - count));
+    for (AsteroidSpawn& s : spawns) {
+        const float angle = nextRandom(seed) * TWO_PI;
+        const float speed = MIN_SPEED + nextRandom(seed) * (MAX_SPEED - MIN_SPEED);
+        s.position = sf::Vector2f(nextRandom(seed) * worldSize.x, nextRandom(seed) * worldSize.y);
+        s.velocity = sf::Vector2f(std::cos(angle), std::sin(angle)) * speed;
+        s.radius = MIN_RADIUS + nextRandom(seed) * (MAX_RADIUS - MIN_RADIUS);
+        s.health = std::ceil(s.radius / RADIUS_PER_HEALTH);
+        s.color = greyColor(static_cast<std::uint8_t>(MIN_SHADE + nextRandom(seed) * SHADE_RANGE));
+    }
+    return spawn(spawns.data(), spawns.size());
+}
+
+bool AsteroidField::despawn(AsteroidId id) {
+    const std::size_t index = indexOf(id);
+    if (index == npos) return false;
+    removeAt(index);
+    return true;
+}
+
+void AsteroidField::despawnSorted(const std::uint32_t* indices, std::size_t indexCount) {
+    // Back to front, so swapping the last asteroid in never moves one still queued
+    for (std::size_t i = indexCount; i-- > 0;) {
+        removeAt(indices[i]);
+    }
+}
+
+void AsteroidField::clear() {
+    for (std::size_t i = 0; i < count; ++i) {
+        if (++generation[slotOf[i]] == 0) generation[slotOf[i]] = 1;
+    }
+    count = 0;
+    freeCount = freeSlots.size();
+    for (std::size_t i = 0; i < freeCount; ++i) {
+        freeSlots[i] = static_cast<std::uint32_t>(freeCount - 1 - i);
+    }
+}
+
+void AsteroidField::update(float deltaTime, const sf::Vector2f& worldSize) {
+    updateRange(0, count, deltaTime, worldSize);
+}
+
+void AsteroidField::updateRange(std::size_t begin, std::size_t end, float deltaTime, const sf::Vector2f& worldSize) {
+    const float width = worldSize.x;
+    const float height = worldSize.y;
+    float* __restrict x = posX.data();
+    float* __restrict y = posY.data();
+    float* __restrict px = prevX.data();
+    float* __restrict py = prevY.data();
+    const float* __restrict vx = velX.data();
+    const float* __restrict vy = velY.data();
+
+    // Branch-free so the compiler can vectorize it
+    for (std::size_t i = begin; i < end; ++i) {
+        float nx = x[i] + vx[i] * deltaTime;
+        float ny = y[i] + vy[i] * deltaTime;
+        nx += nx < 0.f ? width : 0.f;
+        nx -= nx >= width ? width : 0.f;
+        ny += ny < 0.f ? height : 0.f;
+        ny -= ny >= height ? height : 0.f;
+        // Previous position trails by one step even across a wrap, so
+        // interpolation never sweeps across the whole screen
+        px[i] = nx - vx[i] * deltaTime;
+        py[i] = ny - vy[i] * deltaTime;
+        x[i] = nx;
+        y[i] = ny;
+    }
+}
+
+std::size_t AsteroidField::applyHits(const std::vector<CollisionPair>& hits) {
+    damaged.clear();
+    for (const CollisionPair& hit : hits) {
+        if (health[hit.target] > 0.f && (health[hit.target] -= 1.f) <= 0.f) {
+            damaged.push_back(hit.target);
+        }
+    }
+    std::sort(damaged.begin(), damaged.end());
+    despawnSorted(damaged.data(), damaged.size());
+    destroyedCount += damaged.size();
+    return damaged.size();
+}
+
+void AsteroidField::saveArrays(StateBuffer& out) const {
+    out.writeArray(posX.data(), count);
+    out.writeArray(posY.data(), count);
+    out.writeArray(prevX.data(), count);
+    out.writeArray(prevY.data(), count);
+    out.writeArray(velX.data(), count);
+    out.writeArray(velY.data(), count);
+    out.writeArray(radius.data(), count);
+    out.writeArray(health.data(), count);
+    out.writeArray(color.data(), count);
+}
+
+bool AsteroidField::loadArrays(StateReader& in, std::size_t loadCount, std::size_t destroyed) {
+    if (loadCount > capacity()) return false;
+    clear();
+    in.readArray(posX.data(), loadCount);
+    in.readArray(posY.data(), loadCount);
+    in.readArray(prevX.data(), loadCount);
+    in.readArray(prevY.data(), loadCount);
+    in.readArray(velX.data(), loadCount);
+    in.readArray(velY.data(), loadCount);
+    in.readArray(radius.data(), loadCount);
+    in.readArray(health.data(), loadCount);
+    in.readArray(color.data(), loadCount);
+    if (!in.ok()) return false; // Leaves the field empty rather than half loaded
+
+    for (std::size_t i = 0; i < loadCount; ++i) {
+        const std::uint32_t slot = freeSlots[--freeCount];
+        slotOf[i] = slot;
+        denseIndex[slot] = static_cast<std::uint32_t>(i);
+    }
+    count = loadCount;
+    destroyedCount = destroyed;
+    return true;
+}
+
+std::size_t AsteroidField::savedBytes(std::size_t asteroidCount) {
+    return asteroidCount * (8 * sizeof(float) + sizeof(std::uint32_t));
+}
+
+std::size_t AsteroidField::size() const {
+    return count;
+}
+
+std::size_t AsteroidField::capacity() const {
+    return posX.size();
+}
+
+std::size_t AsteroidField::getDestroyedCount() const {
+    return destroyedCount;
+}
+
+AsteroidId AsteroidField::idAt(std::size_t index) const {
+    const std::uint32_t slot = slotOf[index];
+    return AsteroidId{slot, generation[slot]};
+}
+
+std::size_t AsteroidField::indexOf(AsteroidId id) const {
+    if (!id.isValid() || id.slot >= generation.size() || generation[id.slot] != id.generation) {
+        return npos;
+    }
+    return denseIndex[id.slot];
+}
+
+bool AsteroidField::isAlive(AsteroidId id) const {
+    return indexOf(id) != npos;
+}
+
+CollisionBodies AsteroidField::bodies() const {
+    return CollisionBodies{posX.data(), posY.data(), radius.data(), count};
+}
+
+void AsteroidField::removeAt(std::size_t index) {
+    const std::uint32_t slot = slotOf[index];
+    if (++generation[slot] == 0) generation[slot] = 1; // Skip the invalid generation on wrap
+    freeSlots[freeCount++] = slot;
+
+    // Fill the hole with the last asteroid
+    const std::size_t last = --count;
+    if (index != last) {
+        posX[index] = posX[last];
+        posY[index] = posY[last];
+        prevX[index] = prevX[last];
+        prevY[index] = prevY[last];
+        velX[index] = velX[last];
+        velY[index] = velY[last];
+        radius[index] = radius[last];
+        health[index] = health[last];
+        color[index] = color[last];
+        slotOf[index] = slotOf[last];
+        denseIndex[slotOf[index]] = static_cast<std::uint32_t>(index);
+    }
+}
@@ -0,0 +1,31 @@
+#include "AsteroidRenderer.hpp"
+#include "RenderQueue.hpp"
+#include "RenderSnapshot.hpp"
+#include "SpriteAtlas.hpp"
+
+void AsteroidRenderer::draw(RenderQueue& queue, const SpriteAtlas& atlas, const RenderBodies& asteroids, float alpha) {
+    const std::size_t count = asteroids.count;
+    if (count == 0) return;
+
+    const float* curX = asteroids.x.data();
+    const float* curY = asteroids.y.data();
+    const float* prevX = asteroids.prevX.data();
+    const float* prevY = asteroids.prevY.data();
+    const float* radii = asteroids.radius.data();
+    const std::uint32_t* colors = asteroids.color.data();
+    const sf::FloatRect disc = atlas.getRegion(SpriteAtlas::Sprite::Disc);
+    const sf::Vector2f discEnd(disc.left + disc.width, disc.top + disc.height);
+
+    sf::Vertex* quads = queue.push(RenderLayer::World, sf::Quads, &atlas.getTexture(), RenderBlend::Alpha, count * 4);
+    for (std::size_t i = 0; i < count; ++i) {
+        const float x = prevX[i] + (curX[i] - prevX[i]) * alpha;
+        const float y = prevY[i] + (curY[i] - prevY[i]) * alpha;
+        const float r = radii[i];
+        const sf::Color color(colors[i]);
+        sf::Vertex* quad = quads + i * 4;
+        quad[0] = sf::Vertex(sf::Vector2f(x - r, y - r), color, sf::Vector2f(disc.left, disc.top));
+        quad[1] = sf::Vertex(sf::Vector2f(x + r, y - r), color, sf::Vector2f(discEnd.x, disc.top));
+        quad[2] = sf::Vertex(sf::Vector2f(x + r, y + r), color, discEnd);
+        quad[3] = sf::Vertex(sf::Vector2f(x - r, y + r), color, sf::Vector2f(disc.left, discEnd.y));
+    }
+}
@@ -1,19 +1,21 @@
 #include "Attack.hpp"
+#include "ProjectileKernels.hpp"
 
 #include <cmath>
 #include <iostream>
-#include <algorithm>
 
 namespace {
     // Default Attack Parameters
     constexpr float DEFAULT_PROJECTILE_SIZE = 2.0f;
     constexpr float DEFAULT_SHOOT_COOLDOWN_S = 0.05f;
     constexpr float DEFAULT_PROJECTILE_SPEED = 400.0f;
-    constexpr float DEFAULT_SCREEN_WIDTH = 800.0f;
-    constexpr float DEFAULT_SCREEN_HEIGHT = 600.0f;
+    constexpr float DEFAULT_WORLD_WIDTH = 800.0f;
+    constexpr float DEFAULT_WORLD_HEIGHT = 600.0f;
+    constexpr std::size_t DEFAULT_PROJECTILE_CAPACITY = 65536;
+    constexpr std::size_t PROJECTILE_JOB_GRAIN = 8192; // Projectiles per job; fixed so results never depend on thread count
 
     // Projectile Visuals
-    const sf::Color PROJECTILE_COLOR = sf::Color::Yellow;
+    constexpr std::uint32_t PROJECTILE_COLOR = 0xFFFF00FF; // Yellow, RGBA
 
     // Calculation Constants
     constexpr float ANGLE_CORRECTION_DEG = 90.0f;
@@ -21,16 +23,19 @@ namespace {
 }
 
 Attack::Attack()
-    : Attack(DEFAULT_PROJECTILE_SIZE, DEFAULT_SHOOT_COOLDOWN_S, DEFAULT_PROJECTILE_SPEED, DEFAULT_SCREEN_WIDTH, DEFAULT_SCREEN_HEIGHT) {}
+    : Attack(DEFAULT_PROJECTILE_SIZE, DEFAULT_SHOOT_COOLDOWN_S, DEFAULT_PROJECTILE_SPEED, DEFAULT_WORLD_WIDTH, DEFAULT_WORLD_HEIGHT) {}
 
-Attack::Attack(float projectileSize, float shootCooldown, float projectileSpeed, float screenWidth, float screenHeight)
-    : attackActive(false),
+Attack::Attack(float projectileSize, float shootCooldown, float projectileSpeed, float worldWidth, float worldHeight)
+    : projectiles(DEFAULT_PROJECTILE_CAPACITY),
+      jobSystem(nullptr),
+      shotsFired(0),
+      attackActive(false),
       shootCooldown(shootCooldown),
       shootTimer(0.0f),
       projectileSpeed(projectileSpeed),
       projectileSize(projectileSize),
-      screenWidth(screenWidth),
-      screenHeight(screenHeight) {}
+      worldWidth(worldWidth),
+      worldHeight(worldHeight) {}
 
 void Attack::update(float deltaTime, const sf::Vector2f& playerPos, float playerAngle, bool attackActiveInput) {
     // Update attack state
@@ -39,40 +44,23 @@ void Attack::update(float deltaTime, const sf::Vector2f& playerPos, float player
     // Handle shooting
     shootTimer += deltaTime;
     if (attackActive && shootTimer >= shootCooldown) {
-        Projectile proj;
-        proj.shape = sf::CircleShape(projectileSize);
-        proj.shape.setFillColor(PROJECTILE_COLOR);
-        proj.shape.setOrigin(projectileSize, projectileSize);
-        proj.shape.setPosition(playerPos);
-
-        float angleRad = (playerAngle - ANGLE_CORRECTION_DEG) * PI / 180.0f;
-        proj.velocity = sf::Vector2f(std::cos(angleRad), std::sin(angleRad)) * projectileSpeed;
-
-        projectiles.push_back(proj);
+        fire(playerPos, playerAngle);
         shootTimer = 0.0f;
     }
 
-    // Update projectiles
-    for (auto& proj : projectiles) {
-        proj.shape.move(proj.velocity * deltaTime);
-    }
+    // Move projectiles and drop the ones that left the world in a single pass
+    std::size_t survivors = jobSystem
+        ? integrateAndCull(*jobSystem, PROJECTILE_JOB_GRAIN, projectiles.arrays(), projectiles.size(), deltaTime, worldWidth, worldHeight)
+        : integrateAndCull(projectiles.arrays(), projectiles.size(), deltaTime, worldWidth, worldHeight);
+    projectiles.commitCull(survivors);
+}
 
-    // Remove projectiles that are off-screen (using configurable screen size)
-    projectiles.erase(
-        std::remove_if(projectiles.begin(), projectiles.end(),
-            [this](const Projectile& proj) {
-                sf::Vector2f pos = proj.shape.getPosition();
-                // Use screenSize member variable for bounds checking
-                return pos.x < 0 || pos.x > screenSize.x || pos.y < 0 || pos.y > screenSize.y;
-            }),
-        projectiles.end()
-    );
-}
-
-void Attack::draw(sf::RenderWindow& window) {
-    for (const auto& proj : projectiles) {
-        window.draw(proj.shape);
-    }
+ProjectileHandle Attack::fire(const sf::Vector2f& position, float angleDegrees) {
+    float angleRad = (angleDegrees - ANGLE_CORRECTION_DEG) * PI / 180.0f;
+    sf::Vector2f velocity = sf::Vector2f(std::cos(angleRad), std::sin(angleRad)) * projectileSpeed;
+    ++shotsFired;
+
+    return projectiles.add(position, velocity, projectileSize, PROJECTILE_COLOR); // Overflow handled by the pool policy
 }
 
 void Attack::setAttackActive(bool active) {
@@ -83,13 +71,39 @@ bool Attack::isAttackActive() const {
     return attackActive;
 }
 
-const std::vector<Projectile>& Attack::getProjectiles() const {
+void Attack::retireProjectiles(const std::uint32_t* indices, std::size_t count) {
+    projectiles.retireSorted(indices, count);
+}
+
+const ProjectileStore& Attack::getProjectiles() const {
     return projectiles;
 }
 
-// Define the setScreenSize method
-void Attack::setScreenSize(sf::Vector2u size) {
-    screenSize = size;
+std::uint64_t Attack::getShotsFired() const {
+    return shotsFired;
+}
+
+AttackState Attack::getState() const {
+    return AttackState{attackActive, shootCooldown, shootTimer, projectileSpeed, projectileSize, worldWidth, worldHeight};
+}
+
+void Attack::setState(const AttackState& state) {
+    attackActive = state.attackActive;
+    shootCooldown = state.shootCooldown;
+    shootTimer = state.shootTimer;
+    projectileSpeed = state.projectileSpeed;
+    projectileSize = state.projectileSize;
+    worldWidth = state.worldWidth;
+    worldHeight = state.worldHeight;
+}
+
+bool Attack::loadProjectiles(StateReader& in, std::size_t count) {
+    return projectiles.loadArrays(in, count);
+}
+
+void Attack::setWorldSize(const sf::Vector2f& size) {
+    worldWidth = size.x;
+    worldHeight = size.y;
 }
 
 // --- Getters for Debug Controls ---
@@ -117,3 +131,11 @@ void Attack::setShootCooldown(float cooldown) {
 void Attack::setProjectileSpeed(float speed) {
     projectileSpeed = speed;
 }
+
+void Attack::setProjectilePool(std::size_t capacity, PoolOverflowPolicy policy) {
+    projectiles = ProjectileStore(capacity, policy);
+}
+
+void Attack::setJobSystem(JobSystem* jobs) {
+    jobSystem = jobs;
+}
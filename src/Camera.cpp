@@ -0,0 +1,39 @@
+#include "Camera.hpp"
+
+#include <algorithm>
+
+Camera::Camera()
+    : worldSize(0.f, 0.f),
+      viewSize(0.f, 0.f),
+      center(0.f, 0.f) {}
+
+void Camera::setWorldSize(const sf::Vector2f& size) {
+    worldSize = size;
+}
+
+void Camera::setViewSize(const sf::Vector2f& size) {
+    viewSize = size;
+}
+
+void Camera::follow(const sf::Vector2f& target) {
+    center.x = clampAxis(target.x, viewSize.x, worldSize.x);
+    center.y = clampAxis(target.y, viewSize.y, worldSize.y);
+}
+
+float Camera::clampAxis(float target, float viewExtent, float worldExtent) const {
+    if (viewExtent >= worldExtent) return worldExtent / 2.f;
+    const float half = viewExtent / 2.f;
+    return std::min(std::max(target, half), worldExtent - half);
+}
+
+sf::Vector2f Camera::getCenter() const {
+    return center;
+}
+
+sf::Vector2f Camera::getViewSize() const {
+    return viewSize;
+}
+
+sf::Vector2f Camera::getTopLeft() const {
+    return center - viewSize / 2.f;
+}
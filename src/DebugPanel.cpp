@@ -1,8 +1,5 @@
 #include "DebugPanel.hpp"
 
-#include <SFML/Graphics/RectangleShape.hpp>
-#include <SFML/Graphics/CircleShape.hpp>
-
 #include <cmath>
 
 namespace {
@@ -17,7 +14,7 @@ namespace {
     constexpr float COMPASS_RADIUS = 32.f;
     constexpr float COMPASS_OUTLINE_THICKNESS = 2.f;
     const sf::Color COMPASS_OUTLINE_COLOR = sf::Color::White;
-    const sf::Color COMPASS_BACKGROUND_COLOR = sf::Color(0, 0, 0, 0); // Transparent
+    constexpr std::size_t COMPASS_RING_SEGMENTS = 30; // Same as sf::CircleShape's default
     constexpr float COMPASS_NEEDLE_OFFSET = 6.f;
     const sf::Color PLAYER_NEEDLE_COLOR = sf::Color::Red;
     const sf::Color CENTER_NEEDLE_COLOR = sf::Color::Cyan;
@@ -31,122 +28,159 @@ namespace {
     // Calculation Constants
     constexpr float ANGLE_CORRECTION_DEG = 90.f;
     constexpr float PI = 3.14159265f;
+
+    // HUD text is ASCII, so each char is its own code point
+    bool shows(const sf::Text& text, std::string_view line) {
+        const sf::String& shown = text.getString();
+        if (shown.getSize() != line.size()) return false;
+        for (std::size_t i = 0; i < line.size(); ++i) {
+            if (shown[i] != static_cast<unsigned char>(line[i])) return false;
+        }
+        return true;
+    }
 }
 
 // Default values for position and spacing
 DebugPanel::DebugPanel()
-    : position(DEFAULT_POS_X, DEFAULT_POS_Y),
+    : lineCount(0),
+      font(nullptr),
+      position(DEFAULT_POS_X, DEFAULT_POS_Y),
       lineSpacing(DEFAULT_LINE_SPACING),
-      fontSize(DEFAULT_FONT_SIZE)
-{}
+      fontSize(DEFAULT_FONT_SIZE),
+      layoutDirty(true),
+      relayoutCount(0),
+      textDrawCalls(0),
+      needleAngles{0.f, 0.f},
+      compassRings(sf::Triangles),
+      compassNeedles(sf::Lines, 4)
+{
+    compassNeedles[0].color = PLAYER_NEEDLE_COLOR;
+    compassNeedles[1].color = PLAYER_NEEDLE_COLOR;
+    compassNeedles[2].color = CENTER_NEEDLE_COLOR;
+    compassNeedles[3].color = CENTER_NEEDLE_COLOR;
+
+    northLabel.setString("N");
+    northLabel.setCharacterSize(fontSize);
+    northLabel.setFillColor(DEFAULT_TEXT_COLOR);
+    centerLabel.setString("C");
+    centerLabel.setCharacterSize(fontSize);
+    centerLabel.setFillColor(CENTER_NEEDLE_COLOR);
+}
 
 void DebugPanel::setFont(const sf::Font& f) {
-    font = f;
+    font = &f;
+    for (sf::Text& text : texts) {
+        text.setFont(f);
+    }
+    northLabel.setFont(f);
+    centerLabel.setFont(f);
 }
 
 void DebugPanel::setPosition(const sf::Vector2f& pos) {
     position = pos;
+    layoutDirty = true;
 }
 
 void DebugPanel::setLineSpacing(float spacing) {
     lineSpacing = spacing;
+    layoutDirty = true;
 }
 
 void DebugPanel::clear() {
-    lines.clear();
+    lineCount = 0;
 }
 
-void DebugPanel::addLine(const std::string& line) {
-    lines.push_back(line);
-}
-
-void DebugPanel::draw(sf::RenderWindow& window) {
-    float y = position.y;
-    for (const auto& line : lines) {
-        sf::Text text(line, font, fontSize); // Use fontSize member
-        text.setFillColor(DEFAULT_TEXT_COLOR);
-        text.setPosition(position.x, y);
-        window.draw(text);
-        y += lineSpacing; // Use lineSpacing member
+void DebugPanel::addLine(std::string_view line) {
+    const std::size_t index = lineCount++;
+    if (index == texts.size()) {
+        texts.emplace_back();
+        if (font) texts.back().setFont(*font);
+        texts.back().setCharacterSize(fontSize);
+        texts.back().setFillColor(DEFAULT_TEXT_COLOR);
+        texts.back().setPosition(position.x, position.y + index * lineSpacing);
+    }
+    // Only a changed string pays for glyph layout
+    if (!shows(texts[index], line)) {
+        texts[index].setString(sf::String::fromUtf8(line.begin(), line.end()));
+        ++relayoutCount;
     }
 }
 
-void DebugPanel::drawCompass(sf::RenderWindow& window, float angleDegrees) {
-    // Compass parameters
-    sf::Vector2f compassCenter(position.x + COMPASS_RADIUS + COMPASS_1_OFFSET_X, position.y + COMPASS_1_OFFSET_Y);
-
-    // Draw compass circle
-    sf::CircleShape circle(COMPASS_RADIUS);
-    circle.setFillColor(COMPASS_BACKGROUND_COLOR);
-    circle.setOutlineColor(COMPASS_OUTLINE_COLOR);
-    circle.setOutlineThickness(COMPASS_OUTLINE_THICKNESS);
-    circle.setOrigin(COMPASS_RADIUS, COMPASS_RADIUS);
-    circle.setPosition(compassCenter);
-    window.draw(circle);
-
-    // Draw compass needle (player direction)
-    float angleRad = (angleDegrees - ANGLE_CORRECTION_DEG) * PI / 180.f;
-    sf::Vector2f needleEnd = compassCenter + sf::Vector2f(std::cos(angleRad), std::sin(angleRad)) * (COMPASS_RADIUS - COMPASS_NEEDLE_OFFSET);
-
-    sf::Vertex needle[] = {
-        sf::Vertex(compassCenter, PLAYER_NEEDLE_COLOR),
-        sf::Vertex(needleEnd, PLAYER_NEEDLE_COLOR)
-    };
-    window.draw(needle, 2, sf::Lines);
-
-    // Draw N label
-    sf::Text nText("N", font, fontSize); // Use fontSize member
-    nText.setFillColor(DEFAULT_TEXT_COLOR);
-    nText.setPosition(compassCenter.x - COMPASS_LABEL_OFFSET_X, compassCenter.y - COMPASS_RADIUS - COMPASS_LABEL_OFFSET_Y);
-    window.draw(nText);
+void DebugPanel::setCompasses(float headingDegrees, const sf::Vector2f& playerPos, const sf::Vector2f& centerPos) {
+    needleAngles[0] = (headingDegrees - ANGLE_CORRECTION_DEG) * PI / 180.f;
+    // No adjustment: 0 rad points right (east), PI/2 up, PI left, -PI/2 down
+    const sf::Vector2f toCenter = centerPos - playerPos;
+    needleAngles[1] = std::atan2(toCenter.y, toCenter.x);
 }
 
-void DebugPanel::drawCenterCompass(sf::RenderWindow& window, const sf::Vector2f& playerPos, const sf::Vector2f& centerPos) {
-    // Draw a second compass below the first
-    sf::Vector2f compassCenter(position.x + COMPASS_RADIUS + COMPASS_1_OFFSET_X,
-                               position.y + COMPASS_1_OFFSET_Y + COMPASS_RADIUS * COMPASS_2_OFFSET_Y_FACTOR + COMPASS_2_SPACING_Y);
-
-    // Draw compass circle
-    sf::CircleShape circle(COMPASS_RADIUS);
-    circle.setFillColor(COMPASS_BACKGROUND_COLOR);
-    circle.setOutlineColor(COMPASS_OUTLINE_COLOR);
-    circle.setOutlineThickness(COMPASS_OUTLINE_THICKNESS);
-    circle.setOrigin(COMPASS_RADIUS, COMPASS_RADIUS);
-    circle.setPosition(compassCenter);
-    window.draw(circle);
-
-    // Calculate angle from player to center
-    sf::Vector2f toCenter = centerPos - playerPos;
-    float angleRad = std::atan2(toCenter.y, toCenter.x);
-    // No adjustment: 0 rad points right (east), PI/2 up, PI left, -PI/2 down
+void DebugPanel::layout() {
+    for (std::size_t i = 0; i < texts.size(); ++i) {
+        texts[i].setPosition(position.x, position.y + i * lineSpacing);
+    }
 
-    sf::Vector2f needleEnd = compassCenter + sf::Vector2f(std::cos(angleRad), std::sin(angleRad)) * (COMPASS_RADIUS - COMPASS_NEEDLE_OFFSET);
+    // The second compass sits below the first
+    compassCenters[0] = sf::Vector2f(position.x + COMPASS_RADIUS + COMPASS_1_OFFSET_X, position.y + COMPASS_1_OFFSET_Y);
+    compassCenters[1] = compassCenters[0] + sf::Vector2f(0.f, COMPASS_RADIUS * COMPASS_2_OFFSET_Y_FACTOR + COMPASS_2_SPACING_Y);
+
+    // Outline rings, drawn outside the radius like sf::CircleShape's outline
+    compassRings.clear();
+    const float outerRadius = COMPASS_RADIUS + COMPASS_OUTLINE_THICKNESS;
+    for (const sf::Vector2f& center : compassCenters) {
+        for (std::size_t i = 0; i < COMPASS_RING_SEGMENTS; ++i) {
+            const float a0 = 2.f * PI * i / COMPASS_RING_SEGMENTS;
+            const float a1 = 2.f * PI * (i + 1) / COMPASS_RING_SEGMENTS;
+            const sf::Vector2f d0(std::cos(a0), std::sin(a0));
+            const sf::Vector2f d1(std::cos(a1), std::sin(a1));
+            const sf::Vector2f inner0 = center + d0 * COMPASS_RADIUS;
+            const sf::Vector2f outer0 = center + d0 * outerRadius;
+            const sf::Vector2f inner1 = center + d1 * COMPASS_RADIUS;
+            const sf::Vector2f outer1 = center + d1 * outerRadius;
+            compassRings.append(sf::Vertex(inner0, COMPASS_OUTLINE_COLOR));
+            compassRings.append(sf::Vertex(outer0, COMPASS_OUTLINE_COLOR));
+            compassRings.append(sf::Vertex(outer1, COMPASS_OUTLINE_COLOR));
+            compassRings.append(sf::Vertex(inner0, COMPASS_OUTLINE_COLOR));
+            compassRings.append(sf::Vertex(outer1, COMPASS_OUTLINE_COLOR));
+            compassRings.append(sf::Vertex(inner1, COMPASS_OUTLINE_COLOR));
+        }
+    }
+
+    northLabel.setPosition(compassCenters[0].x - COMPASS_LABEL_OFFSET_X, compassCenters[0].y - COMPASS_RADIUS - COMPASS_LABEL_OFFSET_Y);
+    centerLabel.setPosition(compassCenters[1].x - COMPASS_LABEL_OFFSET_X, compassCenters[1].y - COMPASS_RADIUS - COMPASS_LABEL_OFFSET_Y);
+    layoutDirty = false;
+}
 
-    sf::Vertex needle[] = {
-        sf::Vertex(compassCenter, CENTER_NEEDLE_COLOR),
-        sf::Vertex(needleEnd, CENTER_NEEDLE_COLOR)
-    };
-    window.draw(needle, 2, sf::Lines);
+void DebugPanel::draw(sf::RenderWindow& window, RenderQueue& overlay) {
+    if (layoutDirty) layout();
 
-    // Draw C label for "Center"
-    sf::Text cText("C", font, fontSize); // Use fontSize member
-    cText.setFillColor(CENTER_NEEDLE_COLOR);
-    cText.setPosition(compassCenter.x - COMPASS_LABEL_OFFSET_X, compassCenter.y - COMPASS_RADIUS - COMPASS_LABEL_OFFSET_Y);
-    window.draw(cText);
+    for (std::size_t i = 0; i < lineCount; ++i) {
+        window.draw(texts[i]);
+    }
+    window.draw(northLabel);
+    window.draw(centerLabel);
+    textDrawCalls = static_cast<unsigned int>(lineCount) + 2;
+
+    // Needles are the only geometry that changes every frame
+    for (std::size_t i = 0; i < 2; ++i) {
+        const sf::Vector2f direction(std::cos(needleAngles[i]), std::sin(needleAngles[i]));
+        compassNeedles[i * 2].position = compassCenters[i];
+        compassNeedles[i * 2 + 1].position = compassCenters[i] + direction * (COMPASS_RADIUS - COMPASS_NEEDLE_OFFSET);
+    }
+    overlay.push(RenderLayer::Overlay, compassRings);
+    overlay.push(RenderLayer::Overlay, compassNeedles);
 }
 
-void DebugPanel::createDebugWindow() {
+void DebugPanel::createDebugWindow(const sf::Font& windowFont) {
     if (!debugWindow) {
         debugWindow = std::make_unique<DebugWindow>();
-        debugWindow->create();
+        debugWindow->create(windowFont);
     } else if (!debugWindow->isOpen()) {
-        debugWindow->create();
+        debugWindow->create(windowFont);
     }
 }
 
-void DebugPanel::updateDebugWindow(Player& player, Attack& attack) {
+void DebugPanel::updateDebugWindow(Player& player, Attack& attack, const DebugStats& stats, FrameArena& arena) {
     if (debugWindow && debugWindow->isOpen()) {
-        debugWindow->update(player, attack);
+        debugWindow->update(player, attack, stats, arena);
     }
 }
 
@@ -155,3 +189,7 @@ void DebugPanel::closeDebugWindow() {
         debugWindow->close();
     }
 }
+
+TimeControl DebugPanel::takeDebugTimeControl() {
+    return debugWindow ? debugWindow->takeTimeControl() : TimeControl();
+}
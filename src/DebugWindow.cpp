@@ -1,20 +1,19 @@
 #include "DebugWindow.hpp"
 #include "Player.hpp" // Include necessary headers for update method parameters
 #include "Attack.hpp"
+#include "ProjectileKernels.hpp"
+#include "FrameText.hpp"
 
 #include <SFML/Window/Event.hpp>
-#include <iostream> // For error messages
-#include <string>   // For std::to_string
-#include <sstream>  // For formatting text
-#include <iomanip>  // For std::fixed, std::setprecision
+#include <string_view>
 // #include <cmath> // Keep if needed for other things, remove if only for sliders
 
 namespace {
-    const std::string FONT_PATH = "../assets/arial.ttf";
     const unsigned int WINDOW_WIDTH = 300;
-    const unsigned int WINDOW_HEIGHT = 400; // Adjust as needed without sliders
+    const unsigned int WINDOW_HEIGHT = 520; // Adjust as needed without sliders
     const unsigned int FONT_SIZE = 14;
     const float TEXT_PADDING = 10.f; // Padding for text
+    const std::size_t TEXT_CAPACITY = 2048; // Characters; the rest is cut off
 }
 
 DebugWindow::DebugWindow() : m_isOpen(false) {}
@@ -23,24 +22,16 @@ DebugWindow::~DebugWindow() {
     close(); // Ensure window is closed and resources released
 }
 
-void DebugWindow::loadFont() {
-    if (!font.loadFromFile(FONT_PATH)) {
-        std::cerr << "Error loading font: " << FONT_PATH << std::endl;
-        // Handle font loading failure (e.g., use a default font or exit)
-    }
-    m_text.setFont(font);
-    m_text.setCharacterSize(FONT_SIZE);
-    m_text.setFillColor(sf::Color::White);
-    m_text.setPosition(TEXT_PADDING, TEXT_PADDING);
-}
-
-void DebugWindow::create() {
+void DebugWindow::create(const sf::Font& font) {
     if (m_isOpen) return;
 
     window = std::make_unique<sf::RenderWindow>(sf::VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT), "Debug Controls", sf::Style::Titlebar | sf::Style::Close);
     window->setVerticalSyncEnabled(true); // Optional: Sync framerate
     m_isOpen = true;
-    loadFont(); // Load font when window is created
+    m_text.setFont(font);
+    m_text.setCharacterSize(FONT_SIZE);
+    m_text.setFillColor(sf::Color::White);
+    m_text.setPosition(TEXT_PADDING, TEXT_PADDING);
 }
 
 bool DebugWindow::isOpen() const {
@@ -55,14 +46,53 @@ void DebugWindow::close() {
     // Release resources if needed, unique_ptr handles window memory
 }
 
-void DebugWindow::update(Player& player, Attack& attack) {
+void DebugWindow::update(Player& player, Attack& attack, const DebugStats& stats, FrameArena& arena) {
     if (!isOpen()) return;
 
-    std::string debugInfo = "Player Pos: (" + std::to_string(static_cast<int>(player.getPosition().x)) + ", " + std::to_string(static_cast<int>(player.getPosition().y)) + ")\n";
-    debugInfo += "Attack Active: " + std::string(attack.isAttackActive() ? "Yes" : "No") + "\n";
-    debugInfo += "Projectiles: " + std::to_string(attack.getProjectiles().size()) + "\n";
+    FrameText info(arena, TEXT_CAPACITY);
+    info << "Player Pos: (" << static_cast<int>(player.getPosition().x) << ", " << static_cast<int>(player.getPosition().y) << ")\n";
+    info << "Attack Active: " << (attack.isAttackActive() ? "Yes" : "No") << "\n";
+    info << "Projectiles: " << attack.getProjectiles().size() << "\n";
+    info << "Projectile Kernel: " << simdLevelName(detectSimdLevel()) << "\n";
+    info << "Asteroids: " << stats.asteroids << " (" << stats.asteroidsDestroyed << " destroyed)\n";
+    info << "Draw Calls: " << stats.drawCalls << " (" << stats.renderCommands << " commands queued)\n";
+    info << "Culling: " << stats.projectilesDrawn << " projectiles, " << stats.asteroidsDrawn
+         << " asteroids drawn; " << stats.visibleChunks << "/" << stats.worldChunks << " chunks\n";
+    info << "Particles: " << stats.particles << " live, update " << stats.particleUpdateMs << " ms\n";
+    info << "Render Thread: " << (stats.renderThreaded ? "On" : "Off") << "\n";
+    info << "Main Loop: " << stats.mainFrameMs << " ms, Render: " << stats.renderFrameMs << " ms\n";
+    info << "Frames Simulated/Rendered: " << stats.simulatedFrames << "/" << stats.renderedFrames << "\n";
+    info << "Dropped Ticks: " << stats.droppedTicks << "\n";
+    info << "HUD Relayouts: " << stats.hudRelayouts << "\n";
+    const FrameArenaStats& frameArena = stats.frameArena;
+    info << "Frame Arena: " << frameArena.lastFrameBytes << " B, peak " << frameArena.highWaterBytes << " of "
+         << frameArena.capacityBytes << " B, " << frameArena.overflows << " heap fallbacks\n";
+    if (stats.pacing.targetMs > 0.f) {
+        info << "Pacing: " << stats.pacing.targetMs << " ms target, p50 +-" << stats.pacing.p50DeviationMs
+             << " ms, p99 +-" << stats.pacing.p99DeviationMs << " ms, " << stats.pacing.missedFrames << " missed\n";
+    } else {
+        info << "Pacing: unlimited\n";
+    }
+    info << "Resources: " << stats.resources.entries << " (" << stats.resources.residentBytes / 1024 << " KB, "
+         << stats.resources.mappedBytes / 1024 << " KB mapped), "
+         << stats.resources.hits << " hits, " << stats.resources.misses << " misses\n";
+    const SimulationHistoryStats& history = stats.history;
+    info << "History: ticks " << history.oldestTick << "-" << history.newestTick
+         << ", " << history.keyframes << " keyframes (" << history.keyframeBytes / 1024 << " KB)\n";
+    info << "Capture: " << history.captureUsPerTick << " us/tick, keyframe " << history.lastKeyframeUs << " us\n";
+    if (!stats.rewindAvailable) {
+        info << "Rewind: off while recording or replaying\n";
+    } else if (stats.rewinding) {
+        info << "REWOUND to tick " << stats.tick << " (seek " << history.lastSeekMs << " ms, "
+             << history.lastSeekTicks << " ticks)\n";
+        info << "Space: resume, Left/Right: tick, PgUp/PgDn: 1 s\n";
+    } else {
+        info << "Rewind: Space to freeze, Left/Right to step\n";
+    }
 
-    m_text.setString(debugInfo);
+    // sf::Text keeps its own copy, so the arena can be reset after this
+    const std::string_view text = info.view();
+    m_text.setString(sf::String::fromUtf8(text.begin(), text.end()));
 
     // Process events before rendering
     processEvents(); 
@@ -78,12 +108,27 @@ void DebugWindow::processEvents() {
     while (window->pollEvent(event)) {
         if (event.type == sf::Event::Closed) {
             close();
+        } else if (event.type == sf::Event::KeyPressed) {
+            switch (event.key.code) {
+                case sf::Keyboard::Space: timeControl.toggleRewind = !timeControl.toggleRewind; break;
+                case sf::Keyboard::Left: --timeControl.stepTicks; break;
+                case sf::Keyboard::Right: ++timeControl.stepTicks; break;
+                case sf::Keyboard::PageUp: --timeControl.stepSeconds; break;
+                case sf::Keyboard::PageDown: ++timeControl.stepSeconds; break;
+                default: break;
+            }
         }
     }
 }
 
 
 
+TimeControl DebugWindow::takeTimeControl() {
+    const TimeControl taken = timeControl;
+    timeControl = TimeControl();
+    return taken;
+}
+
 void DebugWindow::render() {
     if (!window || !isOpen()) return;
     
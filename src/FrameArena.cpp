@@ -0,0 +1,60 @@
+#include "FrameArena.hpp"
+
+#include <algorithm>
+
+namespace {
+    constexpr std::size_t MIN_CAPACITY = 256;
+
+    std::size_t alignUp(std::size_t value, std::size_t alignment) {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+}
+
+FrameArena::FrameArena(std::size_t initialCapacity)
+    : block(),
+      capacity(std::max(initialCapacity, MIN_CAPACITY)),
+      offset(0),
+      overflowBytes(0)
+{
+    block.reset(new unsigned char[capacity]);
+    stats.capacityBytes = capacity;
+}
+
+void* FrameArena::allocate(std::size_t size, std::size_t alignment) {
+    // new[] only guarantees fundamental alignment, so align the address, not the offset
+    const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(block.get());
+    const std::size_t start = alignUp(base + offset, alignment) - base;
+    if (start + size <= capacity) {
+        offset = start + size;
+        return block.get() + start;
+    }
+
+    ++stats.overflows;
+    overflowBytes += size + alignment;
+    overflowBlocks.emplace_back(new unsigned char[size + alignment]);
+    const std::uintptr_t raw = reinterpret_cast<std::uintptr_t>(overflowBlocks.back().get());
+    return reinterpret_cast<void*>(alignUp(raw, alignment));
+}
+
+void FrameArena::reset() {
+    const std::size_t used = getUsedBytes();
+    stats.lastFrameBytes = used;
+    stats.highWaterBytes = std::max(stats.highWaterBytes, used);
+
+    if (!overflowBlocks.empty()) {
+        overflowBlocks.clear();
+        capacity = alignUp(stats.highWaterBytes, MIN_CAPACITY);
+        block.reset(new unsigned char[capacity]);
+        stats.capacityBytes = capacity;
+    }
+    offset = 0;
+    overflowBytes = 0;
+}
+
+std::size_t FrameArena::getUsedBytes() const {
+    return offset + overflowBytes;
+}
+
+FrameArenaStats FrameArena::getStats() const {
+    return stats;
+}
@@ -0,0 +1,111 @@
+#include "FramePacer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace {
+    // Spin margin bounds. Linux sleeps usually wake within ~100us; other
+    // schedulers can be a millisecond or more late.
+    constexpr float INITIAL_SPIN_MARGIN_US = 1000.f;
+    constexpr float MIN_SPIN_MARGIN_US = 200.f;
+    constexpr float MAX_SPIN_MARGIN_US = 4000.f;
+    constexpr float OVERSLEEP_SMOOTHING = 0.1f; // Weight of the newest sample
+    constexpr float OVERSLEEP_HEADROOM = 2.f;   // Margin as a multiple of the average oversleep
+
+    float percentile(float* values, std::size_t count, float fraction) {
+        const std::size_t rank = std::min(count - 1, static_cast<std::size_t>(fraction * count));
+        std::nth_element(values, values + rank, values + count);
+        return values[rank];
+    }
+}
+
+FramePacer::FramePacer()
+    : targetRate(0.f),
+      period(Clock::duration::zero()),
+      scheduled(false),
+      spinMarginUs(INITIAL_SPIN_MARGIN_US),
+      oversleepAvgUs(INITIAL_SPIN_MARGIN_US / OVERSLEEP_HEADROOM),
+      deviationHistoryMs{},
+      historyHead(0),
+      historyCount(0),
+      missedFrames(0) {}
+
+void FramePacer::setTargetRate(float hz) {
+    targetRate = hz > 0.f ? hz : 0.f;
+    period = targetRate > 0.f
+        ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / targetRate))
+        : Clock::duration::zero();
+    reset();
+    historyCount = 0;
+    historyHead = 0;
+    missedFrames = 0;
+}
+
+float FramePacer::getTargetRate() const {
+    return targetRate;
+}
+
+void FramePacer::reset() {
+    scheduled = false;
+}
+
+void FramePacer::waitForNextFrame() {
+    if (period == Clock::duration::zero()) return;
+
+    Clock::time_point now = Clock::now();
+    if (!scheduled) {
+        // First frame after a reset starts the schedule; nothing to measure yet
+        scheduled = true;
+        lastFrameStart = now;
+        nextDeadline = now + period;
+        return;
+    }
+
+    const Clock::time_point sleepUntil =
+        nextDeadline - std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float, std::micro>(spinMarginUs));
+    if (now < sleepUntil) {
+        std::this_thread::sleep_until(sleepUntil);
+        now = Clock::now();
+        const float oversleepUs = std::chrono::duration<float, std::micro>(now - sleepUntil).count();
+        oversleepAvgUs += (oversleepUs - oversleepAvgUs) * OVERSLEEP_SMOOTHING;
+        spinMarginUs = std::min(MAX_SPIN_MARGIN_US, std::max(MIN_SPIN_MARGIN_US, oversleepAvgUs * OVERSLEEP_HEADROOM));
+    }
+    while (now < nextDeadline) {
+        now = Clock::now();
+    }
+
+    const bool late = now - nextDeadline >= period / 10;
+    record(now);
+    if (late) {
+        // Don't burst to catch up; restart the schedule from here
+        ++missedFrames;
+        nextDeadline = now + period;
+    } else {
+        nextDeadline += period;
+    }
+}
+
+void FramePacer::record(Clock::time_point frameStart) {
+    const float intervalMs = std::chrono::duration<float, std::milli>(frameStart - lastFrameStart).count();
+    const float targetMs = std::chrono::duration<float, std::milli>(period).count();
+    lastFrameStart = frameStart;
+
+    deviationHistoryMs[historyHead] = std::fabs(intervalMs - targetMs);
+    historyHead = (historyHead + 1) % HISTORY_FRAMES;
+    if (historyCount < HISTORY_FRAMES) ++historyCount;
+}
+
+PacingStats FramePacer::getStats() const {
+    PacingStats stats;
+    stats.targetMs = std::chrono::duration<float, std::milli>(period).count();
+    stats.missedFrames = missedFrames;
+    stats.samples = historyCount;
+    if (historyCount == 0) return stats;
+
+    std::array<float, HISTORY_FRAMES> sorted;
+    std::copy(deviationHistoryMs.begin(), deviationHistoryMs.begin() + historyCount, sorted.begin());
+    stats.p50DeviationMs = percentile(sorted.data(), historyCount, 0.5f);
+    stats.p99DeviationMs = percentile(sorted.data(), historyCount, 0.99f);
+    return stats;
+}
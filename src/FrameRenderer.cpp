@@ -0,0 +1,115 @@
+#include "FrameRenderer.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace {
+    constexpr float MAX_PARTICLE_STEP_S = 0.1f; // After a stall or the pause menu, don't jump
+}
+
+FrameRenderer::FrameRenderer(ProfilerOverlay& profilerOverlay)
+    : profilerOverlay(profilerOverlay),
+      atlasReady(false),
+      drawCalls(0),
+      renderCommands(0),
+      lastFrameMs(0.f),
+      framesRendered(0),
+      hudRelayouts(0),
+      liveParticles(0),
+      particleUpdateMs(0.f) {}
+
+void FrameRenderer::setFont(const sf::Font& font) {
+    hudPanel.setFont(font);
+    profilerOverlay.setFont(font);
+}
+
+void FrameRenderer::render(sf::RenderWindow& window, const RenderSnapshot& snapshot) {
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    const float sinceLastFrame = lastRenderTime.time_since_epoch().count() == 0
+        ? 0.f
+        : std::chrono::duration<float>(start - lastRenderTime).count();
+    lastRenderTime = start;
+    updateParticles(snapshot, std::min(sinceLastFrame, MAX_PARTICLE_STEP_S));
+    if (!atlasReady) {
+        atlas.build(); // Here rather than in the constructor: this is the thread with the GL context
+        atlasReady = true;
+    }
+
+    // The world is drawn through the camera, the overlays in window pixels
+    // (rebuilt every frame, so resizes and fullscreen just work)
+    window.setView(sf::View(snapshot.viewCenter, snapshot.viewSize));
+    window.clear();
+    asteroidRenderer.draw(worldQueue, atlas, snapshot.asteroids, snapshot.alpha);
+    worldRenderer.drawPlayer(worldQueue, atlas, snapshot.playerDrawPosition, snapshot.playerDrawRotation, snapshot.playerScale);
+    worldRenderer.drawProjectiles(worldQueue, atlas, snapshot.projectiles, snapshot.alpha);
+    const sf::Vector2f viewMin = snapshot.viewCenter - snapshot.viewSize / 2.f;
+    particleRenderer.draw(worldQueue, particleEffects, viewMin, viewMin + snapshot.viewSize);
+    worldQueue.submit(window);
+
+    const sf::Vector2f windowSize(static_cast<float>(window.getSize().x), static_cast<float>(window.getSize().y));
+    window.setView(sf::View(windowSize / 2.f, windowSize));
+
+    hudPanel.clear();
+    for (std::size_t i = 0; i < snapshot.hudLineCount; ++i) {
+        hudPanel.addLine(snapshot.hudLines[i].data());
+    }
+    hudPanel.setCompasses(snapshot.playerRotation, snapshot.playerPosition, snapshot.worldCenter);
+    hudPanel.draw(window, overlayQueue);
+    profilerOverlay.draw(window, overlayQueue, snapshot.profiler);
+    overlayQueue.submit(window);
+
+    window.display();
+
+    drawCalls = worldQueue.getDrawCalls() + overlayQueue.getDrawCalls() + hudPanel.getTextDrawCalls()
+              + (snapshot.profiler.visible ? 1 : 0); // The profiler's text
+    renderCommands = worldQueue.getCommandCount() + overlayQueue.getCommandCount();
+    lastFrameMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    ++framesRendered;
+    hudRelayouts = hudPanel.getRelayoutCount();
+}
+
+void FrameRenderer::updateParticles(const RenderSnapshot& snapshot, float deltaTime) {
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    const EffectEvents& events = snapshot.effects;
+    if (events.thrusting) {
+        particleEffects.emitThrust(snapshot.playerDrawPosition, snapshot.playerDrawRotation, snapshot.playerScale, deltaTime);
+    }
+    if (events.shots > 0) {
+        particleEffects.emitMuzzleFlash(snapshot.playerDrawPosition, snapshot.playerDrawRotation, snapshot.playerScale, events.shots);
+    }
+    for (std::size_t i = 0; i < events.impactCount; ++i) {
+        particleEffects.emitImpact(events.impacts[i]);
+    }
+    particleEffects.update(deltaTime);
+
+    liveParticles = particleEffects.size();
+    particleUpdateMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+unsigned int FrameRenderer::getDrawCalls() const {
+    return drawCalls;
+}
+
+std::size_t FrameRenderer::getRenderCommands() const {
+    return renderCommands;
+}
+
+float FrameRenderer::getLastFrameMs() const {
+    return lastFrameMs;
+}
+
+std::uint64_t FrameRenderer::getFramesRendered() const {
+    return framesRendered;
+}
+
+unsigned int FrameRenderer::getHudRelayouts() const {
+    return hudRelayouts;
+}
+
+std::size_t FrameRenderer::getLiveParticles() const {
+    return liveParticles;
+}
+
+float FrameRenderer::getParticleUpdateMs() const {
+    return particleUpdateMs;
+}
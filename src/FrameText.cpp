@@ -0,0 +1,42 @@
+#include "FrameText.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+FrameText::FrameText(FrameArena& arena, std::size_t capacity)
+    : begin(arena.allocateArray<char>(capacity + 1)),
+      cursor(begin),
+      end(begin + capacity)
+{
+    *cursor = '\0';
+}
+
+FrameText& FrameText::operator<<(std::string_view text) {
+    const std::size_t count = std::min(text.size(), static_cast<std::size_t>(end - cursor));
+    std::memcpy(cursor, text.data(), count);
+    cursor += count;
+    *cursor = '\0';
+    return *this;
+}
+
+FrameText& FrameText::operator<<(char c) {
+    if (cursor != end) *cursor++ = c;
+    *cursor = '\0';
+    return *this;
+}
+
+FrameText& FrameText::fixed(float value, int decimals) {
+    return advance(std::to_chars(cursor, end, value, std::chars_format::fixed, decimals));
+}
+
+// A number that doesn't fit is dropped whole and the text is closed, so it
+// never ends in half a number
+FrameText& FrameText::advance(const std::to_chars_result& written) {
+    if (written.ec == std::errc()) {
+        cursor = written.ptr;
+    } else {
+        end = cursor;
+    }
+    *cursor = '\0';
+    return *this;
+}
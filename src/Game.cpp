@@ -1,8 +1,8 @@
 #include "Game.hpp"
-#include "Player.hpp"
-#include "Attack.hpp"
 #include "InputHandler.hpp"
 #include "DebugPanel.hpp"
+#include "HudText.hpp"
+#include "Profiler.hpp"
 
 
 #include <SFML/Graphics.hpp>
@@ -13,21 +13,35 @@
 #include <vector>
 #include <string>
 #include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 
 namespace {
     // Timing
     constexpr float PAUSE_INPUT_COOLDOWN_S = 0.5f;
     constexpr float MENU_INPUT_COOLDOWN_S = 0.2f;
 
-    // Rotation
-    constexpr float NORMAL_ROTATION_SPEED_DEG_S = 180.0f;
-    constexpr float FAST_ROTATION_SPEED_DEG_S = 360.0f;
+    // View culling
+    constexpr float WORLD_CHUNK_SIZE = 256.f;
+    constexpr float VIEW_CULL_MARGIN = 64.f; // Beyond the largest body, plus a tick of movement
 
-    // Movement
-    constexpr float FORWARD_FORCE_UNIT = 1.0f;
+    // Simulation Timing
+    constexpr float DEFAULT_TICK_RATE_HZ = 120.0f;
+    constexpr float DEFAULT_TIME_SCALE = 1.0f;
+    constexpr int DEFAULT_MAX_STEPS_PER_FRAME = 8;
+    constexpr float MAX_STEP_LIMIT_SCALE = 1000.f; // Keeps the scaled step limit well inside an int
+    constexpr float MIN_TICK_RATE_HZ = 1.0f;
 
-    // Attack
-    constexpr float ATTACK_ANGLE_ROTATION_FACTOR = 0.5f;
+    // Rewind history
+    constexpr float HISTORY_SECONDS = 5.0f;
+    constexpr std::size_t HISTORY_KEYFRAME_INTERVAL = 30; // Ticks between full snapshots
+
+    // Frame Pacing
+    constexpr float DEFAULT_FRAME_RATE_HZ = 60.0f;
+
+    // Per-frame scratch memory
+    constexpr std::size_t FRAME_ARENA_BYTES = 16 * 1024; // Grows to the high-water mark if a frame needs more
 
     // Menu Rendering
     const sf::Color MENU_BACKGROUND_COLOR = sf::Color(30, 30, 30, 220);
@@ -41,50 +55,80 @@ namespace {
     constexpr float MENU_ITEM_START_Y = 200.f;
     constexpr float MENU_ITEM_SPACING_Y = 60.f;
 
-    // File Paths
-    const std::string FONT_PATH = "../assets/arial.ttf";
+    // Idle menus
+    const sf::Time MENU_EVENT_TIMEOUT = sf::milliseconds(250); // Longest sleep while waiting for input
+    const sf::Time MENU_EVENT_POLL_SLICE = sf::milliseconds(10);
+    const sf::Time MENU_REFRESH_INTERVAL = sf::seconds(1.f); // Re-blit in case the compositor lost the frame
+
+    // Assets
+    const std::string UI_FONT_NAME = "ARIAL.TTF";
+    const std::string ASSET_PACK_NAME = "assets.pack";
+
+    std::string directoryOf(const std::string& path) {
+        const std::size_t slash = path.find_last_of("/\\");
+        return slash == std::string::npos ? "." : path.substr(0, slash);
+    }
 
     // Fullscreen
     const sf::Vector2i FULLSCREEN_WINDOW_POSITION = {0, 0};
 }
 
 Game::Game()
-    : running(true), paused(false), pauseInputCooldown(0.f), player(400.f, 300.f), attack(), inputHandler(), attackToggle(false),
-      pauseMenuInputCooldown(0.f), inSettingsMenu(false), settingsMenuSelectedIndex(0)
+    : running(true), simulation(sf::Vector2f(SESSION_WORLD_WIDTH, SESSION_WORLD_HEIGHT)), inputHandler(), paused(false),
+      pauseInputCooldown(0.f), pauseMenuInputCooldown(0.f),
+      frameRenderer(profilerOverlay), renderThread(frameRenderer), renderThreadEnabled(true), frameArena(FRAME_ARENA_BYTES),
+      projectileChunks(WORLD_CHUNK_SIZE), asteroidChunks(WORLD_CHUNK_SIZE),
+      projectilesDrawn(0), asteroidsDrawn(0), visibleChunks(0),
+      frameCount(0), lastMainFrameMs(0.f),
+      vsyncEnabled(false), inSettingsMenu(false), settingsMenuSelectedIndex(0), menuDirty(true), menuNeedsBlit(true),
+      tickRate(DEFAULT_TICK_RATE_HZ), timeScale(DEFAULT_TIME_SCALE), maxStepsPerFrame(DEFAULT_MAX_STEPS_PER_FRAME),
+      tickAccumulator(0.f),
+      rewinding(false), lastShotsFired(0), snapshotSkipped(false)
 {
+    framePacer.setTargetRate(DEFAULT_FRAME_RATE_HZ);
+    resources.setAssetDirectory(GAME_ASSET_DIR);
+    setThreadCount(0);
 
 }
 
 void Game::run(sf::RenderWindow& window) {
     sf::Clock clock;
-    sf::Font font;
-    if (!font.loadFromFile(FONT_PATH)) {
-        // Handle error: Font not loaded
-        std::cerr << "Error loading font: " << FONT_PATH << std::endl;
+    uiFont = resources.getFont(UI_FONT_NAME);
+    renderFont = resources.getFontInstance(UI_FONT_NAME);
+    if (!uiFont || !renderFont) {
+        // Handle error: Font not loaded (the cache reports which file)
         stop();
         return;
     }
+    const sf::Font& font = *uiFont;
 
-    debugPanel.setFont(font);
+    frameRenderer.setFont(*renderFont);
+    renderThread.reserve(simulation.getAttack().getProjectiles().capacity(), simulation.getAsteroids().capacity());
+    visibleIndices.reserve(std::max(simulation.getAttack().getProjectiles().capacity(), simulation.getAsteroids().capacity()));
 
     // Set the window title at startup
     window.setTitle(windowTitle);
+    window.setVerticalSyncEnabled(vsyncEnabled);
 
-    // Set initial screen size for attack boundaries
-    attack.setScreenSize(window.getSize());
+    // Recordings start from the state the simulation was created and seeded in
+    if (!recordPath.empty()) {
+        recorder = std::make_unique<InputRecorder>(tickRate, simulation.getWorldSize(), simulation.getPlayer().getPosition(),
+                                                   static_cast<std::uint32_t>(simulation.getAsteroids().size()));
+    }
 
-    // Set the initial view to match the window size
-    sf::View view = window.getDefaultView();
-    view.setSize(static_cast<float>(window.getSize().x), static_cast<float>(window.getSize().y));
-    view.setCenter(window.getSize().x / 2.f, window.getSize().y / 2.f);
-    window.setView(view);
+    history.configure(static_cast<std::size_t>(HISTORY_SECONDS * tickRate), HISTORY_KEYFRAME_INTERVAL);
 
     while (window.isOpen() && isRunning()) {
-        handleWindowEvents(window);
+        PROFILE_NEXT_FRAME();
+        frameArena.reset();
 
         float deltaTime = clock.restart().asSeconds();
 
-        inputHandler.update();
+        {
+            PROFILE_SCOPE("Input");
+            handleWindowEvents(window);
+            inputHandler.update();
+        }
 
         // Update pause input cooldown timer
         if (pauseInputCooldown > 0.f) {
@@ -105,9 +149,15 @@ void Game::run(sf::RenderWindow& window) {
             toggleDebugWindow();
             debugWindowToggleCooldown = PAUSE_INPUT_COOLDOWN_S;
         }
+        if (inputHandler.isProfilerToggled()) {
+            profilerOverlay.toggle();
+        }
 
         // Always update debug window if it's open
-        updateDebugWindow();
+        {
+            PROFILE_SCOPE("Debug window");
+            updateDebugWindow();
+        }
 
         // Pause logic with cooldown
         if (inputHandler.isPausePressed() && pauseInputCooldown == 0.f) {
@@ -116,66 +166,186 @@ void Game::run(sf::RenderWindow& window) {
         }
 
         if (paused) {
+            PROFILE_SCOPE("Menus");
+            renderThread.stop(); // Menus draw on this thread, and may recreate the window
+            framePacer.reset();  // Menus idle on events instead
             handleInput(window); // pass window here
-            if (inSettingsMenu) {
-                renderSettingsMenu(window, font, settingsMenuItems, settingsMenuSelectedIndex);
-            } else {
-                renderPauseMenu(window, font, pauseMenuItems, pauseMenuIndex);
+            // Space is also MenuSelect: don't let the frame's update() carry a
+            // menu press into the first tick after resuming
+            inputHandler.discardAttackToggle();
+            if (paused && window.isOpen()) {
+                presentMenu(window, font);
+                waitForMenuEvent(window);
             }
-            // Only display once per frame, so continue
             continue;
         }
 
-        float rotationApplied = handleRotation(deltaTime);
-        handleMovement(deltaTime);
-        handleAttack(window, deltaTime, rotationApplied); // Pass window here
+        // Advance the simulation in fixed ticks, whatever the frame rate
+        const float tickDelta = 1.f / tickRate;
+        if (rewinding) {
+            tickAccumulator = 0.f; // Frozen on the history; the debug window steps it
+        } else {
+            tickAccumulator += deltaTime * timeScale;
+        }
+        // A frame at 10x needs ten times the ticks of one at 1x to keep up, so
+        // the catch-up allowance grows with the scale
+        const int scaleSteps = static_cast<int>(std::ceil(std::min(timeScale, MAX_STEP_LIMIT_SCALE)));
+        const int stepLimit = maxStepsPerFrame * std::max(1, scaleSteps);
+        int steps = 0;
+        {
+            PROFILE_SCOPE("Simulation");
+            while (tickAccumulator >= tickDelta && steps < stepLimit) {
+                if (replay && replay->isFinished()) {
+                    stop();
+                    break;
+                }
+                stepSimulation(tickDelta);
+                tickAccumulator -= tickDelta;
+                ++steps;
+            }
+        }
+        if (tickAccumulator >= tickDelta) {
+            // Too far behind to catch up: drop the backlog instead of spiralling
+            droppedTicks += static_cast<std::uint64_t>(tickAccumulator / tickDelta);
+            tickAccumulator = std::fmod(tickAccumulator, tickDelta);
+        }
+        const float alpha = rewinding ? 1.f : tickAccumulator / tickDelta;
 
-        // --- Debug panel update ---
-        debugPanel.clear();
-        debugPanel.addLine("Player Dir: " + std::to_string(player.getRotation()) + " deg");
+        present(window, alpha);
+        lastMainFrameMs = clock.getElapsedTime().asSeconds() * 1000.f;
 
-        // Add player position relative to center of the screen
-        sf::Vector2f playerPos = player.getPosition();
-        sf::Vector2u winSize = window.getSize();
-        sf::Vector2f center(winSize.x / 2.f, winSize.y / 2.f);
-        sf::Vector2f rel = playerPos - center;
-        debugPanel.addLine("Rel to Center: (" + std::to_string(rel.x) + ", " + std::to_string(rel.y) + ")");
-        debugPanel.addLine("Press F1 for Debug Window");
+        {
+            PROFILE_SCOPE("Pacing");
+            framePacer.waitForNextFrame();
+        }
+    }
+    renderThread.stop();
+    finishSession();
+}
 
-        render(window);
+// One fixed tick, fed by the keyboard or a replay, and recorded or verified
+// when a session is being captured or checked
+void Game::stepSimulation(float tickDelta) {
+    const TickInput input = replay ? replay->nextTick() : inputHandler.nextTick();
+    if (replay && replay->getWorldSize() != simulation.getWorldSize()) {
+        simulation.setWorldSize(replay->getWorldSize()); // The recorded world, whatever this window's size
+    }
+    const sf::Vector2f tickWorldSize = simulation.getWorldSize();
+    history.record(simulation, input, tickDelta);
+    simulation.step(tickDelta, input);
+
+    pendingEffects.thrusting = input.moveForward;
+    const std::uint64_t shotsFired = simulation.getAttack().getShotsFired();
+    pendingEffects.shots += static_cast<std::uint32_t>(shotsFired - lastShotsFired);
+    lastShotsFired = shotsFired;
+    for (const sf::Vector2f& impact : simulation.getImpacts()) {
+        pendingEffects.addImpact(impact);
+    }
+
+    if (recorder || replay) {
+        const std::uint32_t checksum = simulationChecksum(simulation);
+        if (recorder) recorder->record(input, tickWorldSize, checksum);
+        if (replay) {
+            const bool alreadyDiverged = replay->hasDiverged();
+            if (!replay->verify(checksum) && !alreadyDiverged) {
+                std::cerr << "Replay diverged at tick " << replay->getDivergedTick() << std::endl;
+            }
+        }
+    }
+}
+
+// Debug window rewind controls. Live play resumes from whichever tick is on
+// screen, and the ticks that were ahead of it are dropped.
+void Game::applyTimeControl(const TimeControl& control) {
+    if (recorder || replay) return; // A session has to stay one unbroken timeline
+    if (control.toggleRewind) {
+        rewinding = !rewinding;
+        tickAccumulator = 0.f;
+    }
+    const std::int64_t steps = control.stepTicks + static_cast<std::int64_t>(control.stepSeconds * tickRate);
+    if (steps == 0) return;
+    rewinding = true; // Stepping freezes live play
+    const std::int64_t target = static_cast<std::int64_t>(simulation.getTickCount()) + steps;
+    history.seek(simulation, static_cast<std::uint64_t>(std::max<std::int64_t>(target, 0)));
+    lastShotsFired = simulation.getAttack().getShotsFired(); // Re-simulated shots aren't new
+}
+
+void Game::finishSession() {
+    if (recorder) {
+        if (recorder->save(recordPath)) {
+            std::cout << "Recorded " << recorder->getTickCount() << " ticks to " << recordPath << std::endl;
+        } else {
+            std::cerr << "Couldn't write recording " << recordPath << std::endl;
+        }
+        recorder.reset();
+    }
+    if (replay && !replay->hasDiverged()) {
+        std::cout << "Replay matched its recording for " << simulation.getTickCount() << " ticks" << std::endl;
     }
 }
 
 void Game::handleWindowEvents(sf::RenderWindow& window) {
     sf::Event event;
     while (window.pollEvent(event)) {
-        if (event.type == sf::Event::Closed)
-            window.close();
+        handleWindowEvent(window, event);
     }
 }
 
-float Game::handleRotation(float deltaTime) {
-    float rotationSpeed = 0.f;
-    if (inputHandler.isFastRotateLeft()) {
-        rotationSpeed = -FAST_ROTATION_SPEED_DEG_S; // Use constant
-    } else if (inputHandler.isRotateLeft()) {
-        rotationSpeed = -NORMAL_ROTATION_SPEED_DEG_S; // Use constant
-    } else if (inputHandler.isFastRotateRight()) {
-        rotationSpeed = FAST_ROTATION_SPEED_DEG_S; // Use constant
-    } else if (inputHandler.isRotateRight()) {
-        rotationSpeed = NORMAL_ROTATION_SPEED_DEG_S; // Use constant
+void Game::handleWindowEvent(sf::RenderWindow& window, const sf::Event& event) {
+    inputHandler.handleEvent(event); // Input state comes from events, not OS polling
+    if (event.type == sf::Event::Closed) {
+        renderThread.stop(); // The render thread may be drawing into it
+        window.close();
+    } else if (event.type == sf::Event::Resized) {
+        menuDirty = true; // The cache has to match the new size
+    } else if (event.type == sf::Event::GainedFocus) {
+        menuNeedsBlit = true;
     }
-    player.handleRotation(rotationSpeed, deltaTime);
-    return rotationSpeed * deltaTime;
 }
 
-void Game::handleMovement(float deltaTime) {
-    float force = 0.f;
-    if (inputHandler.isMoveForward()) {
-        force = FORWARD_FORCE_UNIT; // Use constant
+// Redraws the menu into menuCache only if it changed, and copies the cache to
+// the window only when the window needs it
+void Game::presentMenu(sf::RenderWindow& window, const sf::Font& font) {
+    const sf::Vector2u size = window.getSize();
+    if (menuCache.getSize() != size) {
+        menuCache.create(size.x, size.y);
+        menuDirty = true;
+    }
+    const sf::View pixelView(sf::FloatRect(0.f, 0.f, static_cast<float>(size.x), static_cast<float>(size.y)));
+    if (menuDirty) {
+        menuCache.setView(pixelView);
+        if (inSettingsMenu) {
+            renderSettingsMenu(menuCache, font, settingsMenuItems, settingsMenuSelectedIndex);
+        } else {
+            renderPauseMenu(menuCache, font, pauseMenuItems, pauseMenuIndex);
+        }
+        menuCache.display();
+        menuDirty = false;
+        menuNeedsBlit = true;
+    }
+    if (menuNeedsBlit || menuBlitClock.getElapsedTime() >= MENU_REFRESH_INTERVAL) {
+        window.setView(pixelView);
+        window.draw(sf::Sprite(menuCache.getTexture()), sf::RenderStates(sf::BlendNone));
+        window.display();
+        menuNeedsBlit = false;
+        menuBlitClock.restart();
+    }
+}
+
+// SFML 2.5's waitEvent() can't time out, and the menus still need to wake up
+// for cooldowns and the debug window, so poll in short sleeps instead. Returns
+// as soon as an event arrives; the rest are drained by the next iteration.
+void Game::waitForMenuEvent(sf::RenderWindow& window) {
+    PROFILE_SCOPE("Idle");
+    sf::Clock waited;
+    sf::Event event;
+    while (waited.getElapsedTime() < MENU_EVENT_TIMEOUT) {
+        if (window.pollEvent(event)) {
+            handleWindowEvent(window, event);
+            return;
+        }
+        sf::sleep(MENU_EVENT_POLL_SLICE);
     }
-    player.applyMovementForce(force, deltaTime, player.getRotation());
-    player.updateMovement(deltaTime, force);
 }
 
 // Add this getter for window size
@@ -183,47 +353,92 @@ sf::Vector2u Game::getWindowSize(const sf::RenderWindow& window) const {
     return window.getSize();
 }
 
-void Game::handleAttack(sf::RenderWindow& window, float deltaTime, float rotationApplied) {
-    sf::Vector2f playerPos = player.getPosition();
-    sf::Vector2u winSize = getWindowSize(window); // Pass window here
-
-    if (playerPos.x > 0 && playerPos.x < winSize.x && playerPos.y > 0 && playerPos.y < winSize.y) {
-        if (inputHandler.isAttackToggled()) {
-            attackToggle = !attackToggle;
-        }
-        float attackAngle = player.getRotation() + (rotationApplied * ATTACK_ANGLE_ROTATION_FACTOR); // Use constant
-        attack.update(
-            deltaTime,
-            player.getPosition(),
-            attackAngle,
-            attackToggle
-        );
+// Copies what the frame needs out of the simulation, so drawing can overlap
+// the next simulation step
+void Game::fillSnapshot(RenderSnapshot& snapshot, const sf::RenderWindow& window, float alpha) {
+    const Player& player = simulation.getPlayer();
+    const sf::Vector2f worldSize = simulation.getWorldSize();
+    const sf::Vector2f worldCenter = worldSize / 2.f;
+
+    snapshot.frame = frameCount++;
+    snapshot.alpha = alpha;
+    snapshot.playerDrawPosition = player.getInterpolatedPosition(alpha);
+    snapshot.playerDrawRotation = player.getInterpolatedRotation(alpha);
+    snapshot.playerScale = player.getScale();
+    snapshot.playerPosition = player.getPosition();
+    snapshot.playerRotation = player.getRotation();
+    snapshot.worldCenter = worldCenter;
+
+    // Follows the ship as drawn, so the two never jitter against each other
+    camera.setWorldSize(worldSize);
+    camera.setViewSize(sf::Vector2f(window.getSize()));
+    camera.follow(snapshot.playerDrawPosition);
+    snapshot.viewCenter = camera.getCenter();
+    snapshot.viewSize = camera.getViewSize();
+
+    const sf::Vector2f margin(VIEW_CULL_MARGIN, VIEW_CULL_MARGIN);
+    const sf::Vector2f viewMin = camera.getTopLeft() - margin;
+    const sf::Vector2f viewMax = camera.getTopLeft() + camera.getViewSize() + margin;
+    visibleChunks = gatherVisible(simulation.getAttack().getProjectiles(), projectileChunks, worldSize, viewMin, viewMax,
+                                  snapshot.projectiles);
+    visibleChunks += gatherVisible(simulation.getAsteroids(), asteroidChunks, worldSize, viewMin, viewMax,
+                                   snapshot.asteroids);
+    projectilesDrawn = snapshot.projectiles.count;
+    asteroidsDrawn = snapshot.asteroids.count;
+
+    EffectEvents& effects = snapshot.effects;
+    if (!snapshotSkipped) effects.clear();
+    if (rewinding) pendingEffects.clear(); // A frozen ship doesn't burn
+    effects.thrusting = pendingEffects.thrusting;
+    effects.shots += pendingEffects.shots;
+    for (std::size_t i = 0; i < pendingEffects.impactCount; ++i) {
+        effects.addImpact(pendingEffects.impacts[i]);
+    }
+    // Thrust is held, not an event, so it lasts through frames that ran no tick
+    pendingEffects.shots = 0;
+    pendingEffects.impactCount = 0;
+
+    ArenaVector<std::string_view> hudLines{ArenaAllocator<std::string_view>(frameArena)};
+    hudLines.reserve(RenderSnapshot::MAX_HUD_LINES);
+    buildHudLines(player, worldCenter, tickRate, timeScale, frameArena, hudLines);
+    snapshot.hudLineCount = std::min(hudLines.size(), RenderSnapshot::MAX_HUD_LINES);
+    for (std::size_t i = 0; i < snapshot.hudLineCount; ++i) {
+        const std::size_t length = std::min(hudLines[i].size(), RenderSnapshot::HUD_LINE_CAPACITY - 1);
+        std::memcpy(snapshot.hudLines[i].data(), hudLines[i].data(), length);
+        snapshot.hudLines[i][length] = '\0';
     }
 
+    profilerOverlay.capture(snapshot.profiler);
 }
 
-void Game::render(sf::RenderWindow& window) {
-    // Ensure the view is updated each frame (handles resize/fullscreen)
-    sf::View view = window.getView(); // Get the current view (might have been changed)
-    // Or reset to default scaled view:
-    // sf::View view = window.getDefaultView();
-    view.setSize(static_cast<float>(window.getSize().x), static_cast<float>(window.getSize().y));
-    view.setCenter(window.getSize().x / 2.f, window.getSize().y / 2.f);
-    window.setView(view);
-
-    window.clear();
-    player.draw(window);
-    attack.draw(window);
-    debugPanel.draw(window); // Draw debug panel text
-    debugPanel.drawCompass(window, player.getRotation()); // Draw player direction compass
+// Buckets one set of bodies into world chunks and copies those in chunks
+// overlapping [viewMin, viewMax] into the snapshot. Returns the chunks looked at.
+template <typename Bodies>
+std::size_t Game::gatherVisible(const Bodies& bodies, WorldChunks& chunks, const sf::Vector2f& worldSize,
+                                const sf::Vector2f& viewMin, const sf::Vector2f& viewMax, RenderBodies& out) {
+    chunks.setWorldSize(worldSize);
+    chunks.build(bodies.positionsX(), bodies.positionsY(), bodies.size());
+    visibleIndices.clear();
+    const std::size_t looked = chunks.query(viewMin.x, viewMin.y, viewMax.x, viewMax.y, visibleIndices);
+    out.gatherFrom(bodies.positionsX(), bodies.positionsY(), bodies.previousPositionsX(), bodies.previousPositionsY(),
+                   bodies.radii(), bodies.colors(), visibleIndices.data(), visibleIndices.size());
+    return looked;
+}
 
-    // Draw center-pointing compass
-    sf::Vector2f playerPos = player.getPosition();
-    sf::Vector2u winSize = window.getSize();
-    sf::Vector2f center(winSize.x / 2.f, winSize.y / 2.f);
-    debugPanel.drawCenterCompass(window, playerPos, center);
+void Game::present(sf::RenderWindow& window, float alpha) {
+    {
+        PROFILE_SCOPE("Snapshot");
+        fillSnapshot(renderThread.snapshot(), window, alpha);
+    }
 
-    window.display();
+    if (renderThreadEnabled) {
+        if (!renderThread.isRunning()) renderThread.start(window);
+        snapshotSkipped = renderThread.publish();
+    } else {
+        PROFILE_SCOPE("Render");
+        frameRenderer.render(window, renderThread.snapshot());
+        snapshotSkipped = false;
+    }
 }
 
 bool Game::isRunning() const {
@@ -236,47 +451,49 @@ void Game::stop() {
 
 void Game::togglePause() {
     paused = !paused;
+    menuDirty = true;
 }
 
-void Game::renderPauseMenu(sf::RenderWindow& window, sf::Font& font, const std::vector<std::string>& items, int selected) {
-    window.clear(MENU_BACKGROUND_COLOR); // Use constant
+void Game::renderPauseMenu(sf::RenderTarget& target, const sf::Font& font, const std::vector<std::string>& items, int selected) {
+    target.clear(MENU_BACKGROUND_COLOR); // Use constant
 
     sf::Text pausedText("PAUSED", font, MENU_TITLE_FONT_SIZE); // Use constant
     pausedText.setFillColor(sf::Color::White);
     pausedText.setStyle(sf::Text::Bold);
     pausedText.setPosition(MENU_TITLE_POS_X, MENU_TITLE_POS_Y); // Use constants
-    window.draw(pausedText);
+    target.draw(pausedText);
 
     for (size_t i = 0; i < items.size(); ++i) {
         sf::Text item(items[i], font, MENU_ITEM_FONT_SIZE); // Use constant
         item.setPosition(MENU_ITEM_START_X, MENU_ITEM_START_Y + i * MENU_ITEM_SPACING_Y); // Use constants
         item.setFillColor(i == selected ? MENU_ITEM_SELECTED_COLOR : MENU_ITEM_DEFAULT_COLOR); // Use constants
-        window.draw(item);
+        target.draw(item);
     }
-    window.display();
 }
 
-void Game::renderSettingsMenu(sf::RenderWindow& window, sf::Font& font, const std::vector<std::string>& items, int selected) {
-    window.clear(MENU_BACKGROUND_COLOR); // Use constant
+void Game::renderSettingsMenu(sf::RenderTarget& target, const sf::Font& font, const std::vector<std::string>& items, int selected) {
+    target.clear(MENU_BACKGROUND_COLOR); // Use constant
 
     sf::Text settingsText("SETTINGS", font, MENU_TITLE_FONT_SIZE); // Use constant
     settingsText.setFillColor(sf::Color::White);
     settingsText.setStyle(sf::Text::Bold);
     settingsText.setPosition(MENU_TITLE_POS_X, MENU_TITLE_POS_Y); // Use constants
-    window.draw(settingsText);
+    target.draw(settingsText);
 
     for (size_t i = 0; i < items.size(); ++i) {
         sf::Text item(items[i], font, MENU_ITEM_FONT_SIZE); // Use constant
         item.setPosition(MENU_ITEM_START_X, MENU_ITEM_START_Y + i * MENU_ITEM_SPACING_Y); // Use constants
         item.setFillColor(i == selected ? MENU_ITEM_SELECTED_COLOR : MENU_ITEM_DEFAULT_COLOR); // Use constants
-        window.draw(item);
+        target.draw(item);
     }
-    window.display();
 }
 
 // Change signature to accept window reference
 void Game::handleInput(sf::RenderWindow& window) {
     if (paused) {
+        const bool wasInSettings = inSettingsMenu;
+        const int wasPauseIndex = pauseMenuIndex;
+        const int wasSettingsIndex = settingsMenuSelectedIndex;
         if (inSettingsMenu) {
             if (pauseMenuInputCooldown == 0.f) {
                 if (inputHandler.isMenuUp()) {
@@ -295,7 +512,7 @@ void Game::handleInput(sf::RenderWindow& window) {
                         settingsMenuSelectedIndex = 0;
                     }
                     pauseMenuInputCooldown = MENU_INPUT_COOLDOWN_S; // Use constant
-                } else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Escape)) {
+                } else if (inputHandler.isPausePressed()) {
                     inSettingsMenu = false;
                     settingsMenuSelectedIndex = 0;
                     pauseMenuInputCooldown = MENU_INPUT_COOLDOWN_S; // Use constant
@@ -325,6 +542,9 @@ void Game::handleInput(sf::RenderWindow& window) {
                 }
             }
         }
+        if (inSettingsMenu != wasInSettings || pauseMenuIndex != wasPauseIndex || settingsMenuSelectedIndex != wasSettingsIndex) {
+            menuDirty = true;
+        }
     }
 }
 
@@ -356,11 +576,11 @@ void Game::applyFullscreen(sf::RenderWindow& window, bool borderless) {
         borderless ? sf::Style::None : sf::Style::Fullscreen
     );
     window.setPosition(FULLSCREEN_WINDOW_POSITION); // Use constant
+    window.setVerticalSyncEnabled(vsyncEnabled); // Lost with the old window
+    menuNeedsBlit = true;
 
-    // Update attack boundaries after changing screen mode
-    attack.setScreenSize(window.getSize());
-
-    // Update the view to match the new fullscreen size
+    // The world doesn't depend on the window; only the view changes size (the
+    // camera picks up the new window size on the next frame)
     sf::View view = window.getDefaultView();
     view.setSize(static_cast<float>(window.getSize().x), static_cast<float>(window.getSize().y));
     view.setCenter(window.getSize().x / 2.f, window.getSize().y / 2.f);
@@ -369,11 +589,15 @@ void Game::applyFullscreen(sf::RenderWindow& window, bool borderless) {
 
 // Add getters for Player and Attack references
 Player& Game::getPlayer() {
-    return player;
+    return simulation.getPlayer();
 }
 
 Attack& Game::getAttack() {
-    return attack;
+    return simulation.getAttack();
+}
+
+Simulation& Game::getSimulation() {
+    return simulation;
 }
 
 // Add these functions somewhere after the togglePause function in Game.cpp
@@ -382,12 +606,123 @@ void Game::toggleDebugWindow() {
     if (debugPanel.hasDebugWindow()) {
         debugPanel.closeDebugWindow();
     } else {
-        debugPanel.createDebugWindow();
+        debugPanel.createDebugWindow(*uiFont); // Shared with the menus (same thread), so reopening never touches disk
     }
 }
 
 void Game::updateDebugWindow() {
     if (debugPanel.hasDebugWindow()) {
-        debugPanel.updateDebugWindow(player, attack);
+        DebugStats stats;
+        stats.drawCalls = frameRenderer.getDrawCalls();
+        stats.renderCommands = frameRenderer.getRenderCommands();
+        stats.renderThreaded = renderThread.isRunning();
+        stats.mainFrameMs = lastMainFrameMs;
+        stats.renderFrameMs = frameRenderer.getLastFrameMs();
+        stats.simulatedFrames = frameCount;
+        stats.droppedTicks = droppedTicks;
+        stats.renderedFrames = frameRenderer.getFramesRendered();
+        stats.hudRelayouts = frameRenderer.getHudRelayouts();
+        stats.pacing = framePacer.getStats();
+        stats.resources = resources.getStats();
+        stats.asteroids = simulation.getAsteroids().size();
+        stats.asteroidsDestroyed = simulation.getAsteroids().getDestroyedCount();
+        stats.projectilesDrawn = projectilesDrawn;
+        stats.asteroidsDrawn = asteroidsDrawn;
+        stats.visibleChunks = visibleChunks;
+        stats.worldChunks = projectileChunks.getChunkCount() + asteroidChunks.getChunkCount();
+        stats.particles = frameRenderer.getLiveParticles();
+        stats.particleUpdateMs = frameRenderer.getParticleUpdateMs();
+        stats.frameArena = frameArena.getStats();
+        stats.history = history.getStats();
+        stats.tick = simulation.getTickCount();
+        stats.rewinding = rewinding;
+        stats.rewindAvailable = !recorder && !replay;
+        debugPanel.updateDebugWindow(simulation.getPlayer(), simulation.getAttack(), stats, frameArena);
+        applyTimeControl(debugPanel.takeDebugTimeControl());
     }
 }
+
+void Game::setWorldSize(const sf::Vector2f& size) {
+    simulation.setWorldSize(size);
+    simulation.getPlayer().setPosition(size / 2.f);
+}
+
+void Game::setTickRate(float hz) {
+    tickRate = hz > MIN_TICK_RATE_HZ ? hz : MIN_TICK_RATE_HZ;
+}
+
+void Game::setTimeScale(float scale) {
+    timeScale = scale > 0.f ? scale : 0.f; // 0 freezes the simulation
+}
+
+void Game::setMaxStepsPerFrame(int steps) {
+    maxStepsPerFrame = steps > 1 ? steps : 1;
+}
+
+float Game::getTickRate() const {
+    return tickRate;
+}
+
+float Game::getTimeScale() const {
+    return timeScale;
+}
+
+void Game::setThreadCount(std::size_t threads) {
+    simulation.setJobSystem(nullptr);
+    jobSystem.reset(); // Join the old workers before starting new ones
+    jobSystem = std::make_unique<JobSystem>(threads);
+    simulation.setJobSystem(jobSystem.get());
+}
+
+std::size_t Game::getThreadCount() const {
+    return jobSystem->getThreadCount();
+}
+
+void Game::setRenderThreadEnabled(bool enabled) {
+    renderThreadEnabled = enabled;
+    if (!enabled) renderThread.stop();
+}
+
+void Game::setFrameRateLimit(float hz) {
+    framePacer.setTargetRate(hz);
+}
+
+void Game::setVsyncEnabled(bool enabled) {
+    vsyncEnabled = enabled;
+}
+
+void Game::openAssetPack(const std::string& executablePath) {
+    // Built next to the executable; multi-config generators put the
+    // executable one directory further down
+    const std::string dir = directoryOf(executablePath);
+    if (assetPack.open(dir + "/" + ASSET_PACK_NAME) || assetPack.open(dir + "/../" + ASSET_PACK_NAME)) {
+        resources.setAssetPack(&assetPack);
+    } else {
+        std::cerr << "No " << ASSET_PACK_NAME << " next to the executable; loading assets from " << GAME_ASSET_DIR << std::endl;
+    }
+}
+
+void Game::setRecordPath(const std::string& path) {
+    recordPath = path;
+}
+
+bool Game::loadReplay(const std::string& path) {
+    auto loaded = std::make_unique<ReplayInput>();
+    std::string error;
+    if (!loaded->load(path, error)) {
+        std::cerr << "Replay failed: " << error << std::endl;
+        return false;
+    }
+    // Recreate the recorded starting state, ship included: the game's own
+    // world put it somewhere else
+    setTickRate(loaded->getTickRate());
+    setWorldSize(loaded->getInitialWorldSize());
+    simulation.getPlayer().setPosition(loaded->getPlayerStart());
+    simulation.spawnAsteroids(loaded->getAsteroidCount());
+    replay = std::move(loaded);
+    return true;
+}
+
+bool Game::hasReplayDiverged() const {
+    return replay && replay->hasDiverged();
+}
@@ -0,0 +1,115 @@
+#include "Headless.hpp"
+#include "Simulation.hpp"
+#include "JobSystem.hpp"
+#include "InputRecording.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+
+namespace {
+    // Script timing, in seconds of simulated time
+    constexpr float SCRIPT_CYCLE_S = 4.0f;
+    constexpr float SCRIPT_THRUST_S = 0.5f;    // Thrust at the start of each cycle
+    constexpr float SCRIPT_FAST_TURN_S = 2.0f; // Turn fast for the first part of each cycle
+
+    constexpr float MIN_TICK_RATE_HZ = 1.0f; // Same floor as Game::setTickRate
+}
+
+ScriptedInput::ScriptedInput(float tickRate) : tickRate(tickRate), tick(0) {}
+
+TickInput ScriptedInput::nextTick() {
+    const float cycleTime = static_cast<float>(tick % static_cast<std::uint64_t>(SCRIPT_CYCLE_S * tickRate)) / tickRate;
+
+    TickInput input;
+    input.toggleAttack = tick == 0; // Turn auto-fire on once
+    input.rotateRight = true;
+    input.fastRotate = cycleTime < SCRIPT_FAST_TURN_S;
+    input.moveForward = cycleTime < SCRIPT_THRUST_S;
+    ++tick;
+    return input;
+}
+
+int runHeadless(const HeadlessOptions& options) {
+    using Clock = std::chrono::steady_clock;
+
+    // A replay brings its own tick rate, world and asteroids
+    ReplayInput replay;
+    const bool replaying = !options.replayPath.empty();
+    if (replaying) {
+        std::string error;
+        if (!replay.load(options.replayPath, error)) {
+            std::cerr << "Replay failed: " << error << std::endl;
+            return 1;
+        }
+    }
+    const float tickRate = replaying ? replay.getTickRate() : std::max(options.tickRate, MIN_TICK_RATE_HZ);
+    const sf::Vector2f worldSize = replaying ? replay.getInitialWorldSize() : options.worldSize;
+    const std::size_t asteroidCount = replaying ? replay.getAsteroidCount() : options.asteroids;
+    const std::uint64_t tickCount = replaying ? replay.getTickCount() : options.ticks;
+
+    JobSystem jobs(options.threads);
+    Simulation simulation(worldSize);
+    simulation.setJobSystem(&jobs);
+    if (replaying) simulation.getPlayer().setPosition(replay.getPlayerStart());
+    simulation.spawnAsteroids(asteroidCount);
+    ScriptedInput script(tickRate);
+    InputSource& input = replaying ? static_cast<InputSource&>(replay) : script;
+    const float tickDelta = 1.f / tickRate;
+
+    std::unique_ptr<InputRecorder> recorder;
+    if (!options.recordPath.empty()) {
+        recorder = std::make_unique<InputRecorder>(tickRate, worldSize, simulation.getPlayer().getPosition(),
+                                                   static_cast<std::uint32_t>(asteroidCount));
+    }
+    const bool checksums = replaying || recorder;
+
+    std::size_t peakProjectiles = 0;
+    const Clock::time_point start = Clock::now();
+    for (std::uint64_t i = 0; i < tickCount; ++i) {
+        const TickInput tick = input.nextTick();
+        if (replaying && replay.getWorldSize() != simulation.getWorldSize()) {
+            simulation.setWorldSize(replay.getWorldSize());
+        }
+        const sf::Vector2f tickWorldSize = simulation.getWorldSize();
+        simulation.step(tickDelta, tick);
+        if (checksums) {
+            const std::uint32_t checksum = simulationChecksum(simulation);
+            if (replaying) replay.verify(checksum);
+            if (recorder) recorder->record(tick, tickWorldSize, checksum);
+        }
+        peakProjectiles = std::max(peakProjectiles, simulation.getAttack().getProjectiles().size());
+    }
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    const double ticks = static_cast<double>(tickCount);
+    std::cout << "Headless run: " << tickCount << " ticks at " << tickRate << " Hz on "
+              << jobs.getThreadCount() << " threads" << (checksums ? " (with checksums)" : "") << "\n"
+              << "  Wall time:        " << seconds << " s\n"
+              << "  Ticks per second: " << (seconds > 0.0 ? ticks / seconds : 0.0) << "\n"
+              << "  Time per tick:    " << (ticks > 0.0 ? seconds * 1e6 / ticks : 0.0) << " us\n"
+              << "  Sim speed:        " << (seconds > 0.0 ? ticks * tickDelta / seconds : 0.0) << "x real time\n"
+              << "  Peak projectiles: " << peakProjectiles << "\n"
+              << "  Asteroids:        " << simulation.getAsteroids().size() << " left, "
+              << simulation.getAsteroids().getDestroyedCount() << " destroyed" << std::endl;
+
+    int result = 0;
+    if (recorder) {
+        if (recorder->save(options.recordPath)) {
+            std::cout << "  Recorded:         " << recorder->getTickCount() << " ticks to " << options.recordPath << std::endl;
+        } else {
+            std::cerr << "Couldn't write recording " << options.recordPath << std::endl;
+            result = 1;
+        }
+    }
+    if (replaying) {
+        if (replay.hasDiverged()) {
+            std::cout << "  Replay:           DIVERGED at tick " << replay.getDivergedTick() << std::endl;
+            result = 1;
+        } else {
+            std::cout << "  Replay:           all " << tickCount << " checksums match" << std::endl;
+        }
+    }
+    return result;
+}
@@ -0,0 +1,19 @@
+#include "HudText.hpp"
+#include "FrameText.hpp"
+#include "Player.hpp"
+
+namespace {
+    constexpr std::size_t HUD_LINE_CHARS = 64;
+}
+
+void buildHudLines(const Player& player, const sf::Vector2f& worldCenter, float tickRate, float timeScale,
+                   FrameArena& arena, ArenaVector<std::string_view>& lines) {
+    lines.clear();
+    lines.push_back((FrameText(arena, HUD_LINE_CHARS) << "Player Dir: " << player.getRotation() << " deg").view());
+
+    // Player position relative to the center of the world
+    sf::Vector2f rel = player.getPosition() - worldCenter;
+    lines.push_back((FrameText(arena, HUD_LINE_CHARS) << "Rel to Center: (" << rel.x << ", " << rel.y << ")").view());
+    lines.push_back((FrameText(arena, HUD_LINE_CHARS) << "Sim: " << static_cast<int>(tickRate) << " Hz x" << timeScale).view());
+    lines.push_back("Press F1 for Debug Window");
+}
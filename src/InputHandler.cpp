@@ -1,71 +1,169 @@
 #include "InputHandler.hpp"
 
-#include <SFML/Window/Keyboard.hpp>
+namespace {
+    std::size_t index(InputAction action) {
+        return static_cast<std::size_t>(action);
+    }
+
+    bool isValidKey(sf::Keyboard::Key key) {
+        return key > sf::Keyboard::Unknown && key < sf::Keyboard::KeyCount;
+    }
+}
+
+InputHandler::InputHandler() : attackTogglePending(false) {
+    pressTimeUs.fill(-1);
+    for (auto& keys : bindings) {
+        keys.fill(sf::Keyboard::Unknown);
+    }
+
+    // Default bindings
+    bind(InputAction::RotateLeft, sf::Keyboard::A);
+    bind(InputAction::RotateRight, sf::Keyboard::D);
+    bind(InputAction::MoveForward, sf::Keyboard::W);
+    bind(InputAction::FastRotate, sf::Keyboard::LShift);
+    bind(InputAction::FastRotate, sf::Keyboard::RShift, 1);
+    bind(InputAction::ToggleAttack, sf::Keyboard::Space);
+    bind(InputAction::Pause, sf::Keyboard::Escape);
+    bind(InputAction::MenuUp, sf::Keyboard::Up);
+    bind(InputAction::MenuUp, sf::Keyboard::W, 1);
+    bind(InputAction::MenuDown, sf::Keyboard::Down);
+    bind(InputAction::MenuDown, sf::Keyboard::S, 1);
+    bind(InputAction::MenuSelect, sf::Keyboard::Enter);
+    bind(InputAction::MenuSelect, sf::Keyboard::Space, 1);
+    bind(InputAction::ToggleDebugWindow, sf::Keyboard::F1);
+    bind(InputAction::ToggleProfiler, sf::Keyboard::F2);
+}
 
-InputHandler::InputHandler()
-    : rotateLeft(false), rotateRight(false), moveForward(false), attackToggle(false), prevSpacePressed(false),
-      fastRotateLeft(false), fastRotateRight(false), debugWindowToggle(false), prevF1Pressed(false) {}
+void InputHandler::handleEvent(const sf::Event& event) {
+    if (event.type == sf::Event::KeyPressed) {
+        const sf::Keyboard::Key key = event.key.code;
+        if (!isValidKey(key) || down.test(key)) return; // Unknown key, or OS key repeat
+        down.set(key);
+        pendingPressed.set(key);
+        pressTimeUs[key] = clock.getElapsedTime().asMicroseconds();
+    } else if (event.type == sf::Event::KeyReleased) {
+        const sf::Keyboard::Key key = event.key.code;
+        if (!isValidKey(key)) return;
+        down.reset(key);
+        pendingReleased.set(key);
+    } else if (event.type == sf::Event::LostFocus) {
+        // Releases won't reach us any more, so don't leave keys stuck down
+        pendingReleased |= down;
+        down.reset();
+    }
+}
 
 void InputHandler::update() {
-    rotateLeft = sf::Keyboard::isKeyPressed(sf::Keyboard::A);
-    rotateRight = sf::Keyboard::isKeyPressed(sf::Keyboard::D);
-    moveForward = sf::Keyboard::isKeyPressed(sf::Keyboard::W);
+    pressed = pendingPressed;
+    released = pendingReleased;
+    pendingPressed.reset();
+    pendingReleased.reset();
+
+    if (wasPressed(InputAction::ToggleAttack)) {
+        attackTogglePending = true; // Latched until a simulation tick consumes it
+    }
+}
+
+TickInput InputHandler::nextTick() {
+    TickInput input;
+    input.rotateLeft = isRotateLeft();
+    input.rotateRight = isRotateRight();
+    input.fastRotate = isFastRotateLeft() || isFastRotateRight();
+    input.moveForward = isMoveForward();
+    input.toggleAttack = attackTogglePending;
+    attackTogglePending = false;
+    return input;
+}
+
+void InputHandler::discardAttackToggle() {
+    attackTogglePending = false;
+}
 
-    bool spacePressed = sf::Keyboard::isKeyPressed(sf::Keyboard::Space);
-    attackToggle = spacePressed && !prevSpacePressed;
-    prevSpacePressed = spacePressed;
+void InputHandler::bind(InputAction action, sf::Keyboard::Key key, std::size_t slot) {
+    if (slot < BINDINGS_PER_ACTION) {
+        bindings[index(action)][slot] = key;
+    }
+}
 
-    bool shift = sf::Keyboard::isKeyPressed(sf::Keyboard::LShift) || sf::Keyboard::isKeyPressed(sf::Keyboard::RShift);
+bool InputHandler::anyKey(InputAction action, const KeySet& keys) const {
+    for (const sf::Keyboard::Key key : bindings[index(action)]) {
+        if (isValidKey(key) && keys.test(key)) return true;
+    }
+    return false;
+}
 
-    fastRotateLeft = rotateLeft && shift;
-    fastRotateRight = rotateRight && shift;
-    
-    // Debug window toggle with F1
-    bool f1Pressed = sf::Keyboard::isKeyPressed(sf::Keyboard::F1);
-    debugWindowToggle = f1Pressed && !prevF1Pressed;
-    prevF1Pressed = f1Pressed;
+bool InputHandler::isHeld(InputAction action) const {
+    return anyKey(action, down);
+}
+
+bool InputHandler::wasPressed(InputAction action) const {
+    return anyKey(action, pressed);
+}
+
+bool InputHandler::wasReleased(InputAction action) const {
+    return anyKey(action, released);
+}
+
+std::int64_t InputHandler::getPressTimeUs(InputAction action) const {
+    std::int64_t latest = -1;
+    for (const sf::Keyboard::Key key : bindings[index(action)]) {
+        if (isValidKey(key) && pressTimeUs[key] > latest) latest = pressTimeUs[key];
+    }
+    return latest;
+}
+
+bool InputHandler::isActive(InputAction action) const {
+    return isHeld(action) || wasPressed(action);
 }
 
 bool InputHandler::isRotateLeft() const {
-    return rotateLeft;
+    return isActive(InputAction::RotateLeft);
 }
 
 bool InputHandler::isRotateRight() const {
-    return rotateRight;
+    return isActive(InputAction::RotateRight);
 }
 
 bool InputHandler::isMoveForward() const {
-    return moveForward;
+    return isActive(InputAction::MoveForward);
 }
 
 bool InputHandler::isAttackToggled() const {
-    return attackToggle;
+    return wasPressed(InputAction::ToggleAttack);
+}
+
+bool InputHandler::wasAttackJustPressed() const {
+    return wasPressed(InputAction::ToggleAttack);
 }
 
 bool InputHandler::isFastRotateLeft() const {
-    return fastRotateLeft;
+    return isRotateLeft() && isActive(InputAction::FastRotate);
 }
 
 bool InputHandler::isFastRotateRight() const {
-    return fastRotateRight;
+    return isRotateRight() && isActive(InputAction::FastRotate);
 }
 
 bool InputHandler::isPausePressed() const {
-    return sf::Keyboard::isKeyPressed(sf::Keyboard::Escape);
+    return isActive(InputAction::Pause);
 }
 
 bool InputHandler::isMenuUp() const {
-    return sf::Keyboard::isKeyPressed(sf::Keyboard::Up) || sf::Keyboard::isKeyPressed(sf::Keyboard::W);
+    return isActive(InputAction::MenuUp);
 }
 
 bool InputHandler::isMenuDown() const {
-    return sf::Keyboard::isKeyPressed(sf::Keyboard::Down) || sf::Keyboard::isKeyPressed(sf::Keyboard::S);
+    return isActive(InputAction::MenuDown);
 }
 
 bool InputHandler::isMenuSelect() const {
-    return sf::Keyboard::isKeyPressed(sf::Keyboard::Enter) || sf::Keyboard::isKeyPressed(sf::Keyboard::Space);
+    return isActive(InputAction::MenuSelect);
 }
 
 bool InputHandler::isDebugWindowToggled() const {
-    return debugWindowToggle;
+    return wasPressed(InputAction::ToggleDebugWindow);
+}
+
+bool InputHandler::isProfilerToggled() const {
+    return wasPressed(InputAction::ToggleProfiler);
 }
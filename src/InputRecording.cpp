@@ -0,0 +1,243 @@
+#include "InputRecording.hpp"
+#include "Simulation.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace {
+    constexpr char RECORDING_MAGIC[4] = {'G', 'R', 'E', 'C'};
+    constexpr std::uint32_t RECORDING_VERSION = 2;
+    constexpr std::uint32_t RECORDING_VERSION_NO_START = 1; // Header ends before playerStartX
+
+    // Tick flag bits
+    constexpr std::uint8_t TICK_ROTATE_LEFT = 1 << 0;
+    constexpr std::uint8_t TICK_ROTATE_RIGHT = 1 << 1;
+    constexpr std::uint8_t TICK_FAST_ROTATE = 1 << 2;
+    constexpr std::uint8_t TICK_MOVE_FORWARD = 1 << 3;
+    constexpr std::uint8_t TICK_TOGGLE_ATTACK = 1 << 4;
+    constexpr std::uint8_t TICK_WORLD_RESIZED = 1 << 7;
+    constexpr std::size_t MIN_TICK_BYTES = sizeof(std::uint8_t) + sizeof(std::uint32_t); // Flags and checksum
+
+    // 64-bit FNV-1a, a word at a time
+    constexpr std::uint64_t HASH_SEED = 0xCBF29CE484222325ull;
+    constexpr std::uint64_t HASH_PRIME = 0x100000001B3ull;
+
+    void hashWord(std::uint64_t& hash, std::uint32_t word) {
+        hash = (hash ^ word) * HASH_PRIME;
+    }
+
+    void hashFloat(std::uint64_t& hash, float value) {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        hashWord(hash, bits);
+    }
+
+    void hashFloats(std::uint64_t& hash, const float* values, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            hashFloat(hash, values[i]);
+        }
+    }
+
+    template <typename T>
+    void append(std::vector<std::uint8_t>& out, const T& value) {
+        const std::uint8_t* bytes = reinterpret_cast<const std::uint8_t*>(&value);
+        out.insert(out.end(), bytes, bytes + sizeof(T));
+    }
+
+    template <typename T>
+    bool read(const std::vector<char>& in, std::size_t& offset, T& value) {
+        if (in.size() - offset < sizeof(T)) return false;
+        std::memcpy(&value, in.data() + offset, sizeof(T));
+        offset += sizeof(T);
+        return true;
+    }
+}
+
+std::uint32_t simulationChecksum(const Simulation& simulation) {
+    std::uint64_t hash = HASH_SEED;
+
+    const Player& player = simulation.getPlayer();
+    hashFloat(hash, player.getPosition().x);
+    hashFloat(hash, player.getPosition().y);
+    hashFloat(hash, player.getVelocity().x);
+    hashFloat(hash, player.getVelocity().y);
+    hashFloat(hash, player.getRotation());
+
+    const Attack& attack = simulation.getAttack();
+    const ProjectileStore& projectiles = attack.getProjectiles();
+    hashWord(hash, attack.isAttackActive() ? 1u : 0u);
+    hashWord(hash, static_cast<std::uint32_t>(projectiles.size()));
+    hashFloats(hash, projectiles.positionsX(), projectiles.size());
+    hashFloats(hash, projectiles.positionsY(), projectiles.size());
+
+    const AsteroidField& asteroids = simulation.getAsteroids();
+    hashWord(hash, static_cast<std::uint32_t>(asteroids.size()));
+    hashWord(hash, static_cast<std::uint32_t>(asteroids.getDestroyedCount()));
+    hashFloats(hash, asteroids.positionsX(), asteroids.size());
+    hashFloats(hash, asteroids.positionsY(), asteroids.size());
+
+    return static_cast<std::uint32_t>(hash ^ (hash >> 32));
+}
+
+InputRecorder::InputRecorder(float tickRate, const sf::Vector2f& worldSize, const sf::Vector2f& playerStart,
+                             std::uint32_t asteroids)
+    : lastWorldSize(worldSize) {
+    std::memcpy(header.magic, RECORDING_MAGIC, sizeof(header.magic));
+    header.version = RECORDING_VERSION;
+    header.tickRate = tickRate;
+    header.worldWidth = worldSize.x;
+    header.worldHeight = worldSize.y;
+    header.asteroids = asteroids;
+    header.tickCount = 0;
+    header.playerStartX = playerStart.x;
+    header.playerStartY = playerStart.y;
+}
+
+void InputRecorder::record(const TickInput& input, const sf::Vector2f& worldSize, std::uint32_t checksum) {
+    std::uint8_t flags = 0;
+    if (input.rotateLeft) flags |= TICK_ROTATE_LEFT;
+    if (input.rotateRight) flags |= TICK_ROTATE_RIGHT;
+    if (input.fastRotate) flags |= TICK_FAST_ROTATE;
+    if (input.moveForward) flags |= TICK_MOVE_FORWARD;
+    if (input.toggleAttack) flags |= TICK_TOGGLE_ATTACK;
+    const bool resized = worldSize != lastWorldSize;
+    if (resized) flags |= TICK_WORLD_RESIZED;
+
+    ticks.push_back(flags);
+    if (resized) {
+        append(ticks, worldSize.x);
+        append(ticks, worldSize.y);
+        lastWorldSize = worldSize;
+    }
+    append(ticks, checksum);
+    ++header.tickCount;
+}
+
+bool InputRecorder::save(const std::string& path) const {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(ticks.data()), static_cast<std::streamsize>(ticks.size()));
+    return static_cast<bool>(out);
+}
+
+std::uint64_t InputRecorder::getTickCount() const {
+    return header.tickCount;
+}
+
+ReplayInput::ReplayInput() : header(), next(0), diverged(false), divergedTick(0) {}
+
+bool ReplayInput::load(const std::string& path, std::string& error) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        error = "can't open " + path;
+        return false;
+    }
+    const std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    // Version 1 headers are the current one without the player start
+    constexpr std::size_t NO_START_HEADER_BYTES = offsetof(RecordingHeader, playerStartX);
+    if (data.size() < NO_START_HEADER_BYTES || std::memcmp(data.data(), RECORDING_MAGIC, sizeof(header.magic)) != 0) {
+        error = path + " is not an input recording";
+        return false;
+    }
+    std::memcpy(&header, data.data(), NO_START_HEADER_BYTES);
+    std::size_t offset = NO_START_HEADER_BYTES;
+    if (header.version == RECORDING_VERSION_NO_START) {
+        header.playerStartX = header.worldWidth / 2.f;
+        header.playerStartY = header.worldHeight / 2.f;
+    } else if (header.version != RECORDING_VERSION) {
+        error = path + " has unsupported version " + std::to_string(header.version);
+        return false;
+    } else if (!read(data, offset, header.playerStartX) || !read(data, offset, header.playerStartY)) {
+        error = path + " is not an input recording";
+        return false;
+    }
+
+    // The count comes from the file: check it fits before reserving for it
+    if (header.tickCount > (data.size() - offset) / MIN_TICK_BYTES) {
+        error = path + " is truncated: header claims " + std::to_string(header.tickCount) + " ticks";
+        return false;
+    }
+    ticks.clear();
+    ticks.reserve(static_cast<std::size_t>(header.tickCount));
+    sf::Vector2f worldSize(header.worldWidth, header.worldHeight);
+    for (std::uint64_t i = 0; i < header.tickCount; ++i) {
+        std::uint8_t flags;
+        Tick tick;
+        bool ok = read(data, offset, flags);
+        if (ok && (flags & TICK_WORLD_RESIZED)) {
+            ok = read(data, offset, worldSize.x) && read(data, offset, worldSize.y);
+        }
+        ok = ok && read(data, offset, tick.checksum);
+        if (!ok) {
+            error = path + " is truncated at tick " + std::to_string(i);
+            return false;
+        }
+        tick.input.rotateLeft = (flags & TICK_ROTATE_LEFT) != 0;
+        tick.input.rotateRight = (flags & TICK_ROTATE_RIGHT) != 0;
+        tick.input.fastRotate = (flags & TICK_FAST_ROTATE) != 0;
+        tick.input.moveForward = (flags & TICK_MOVE_FORWARD) != 0;
+        tick.input.toggleAttack = (flags & TICK_TOGGLE_ATTACK) != 0;
+        tick.worldSize = worldSize;
+        ticks.push_back(tick);
+    }
+
+    next = 0;
+    diverged = false;
+    divergedTick = 0;
+    return true;
+}
+
+float ReplayInput::getTickRate() const {
+    return header.tickRate;
+}
+
+sf::Vector2f ReplayInput::getInitialWorldSize() const {
+    return sf::Vector2f(header.worldWidth, header.worldHeight);
+}
+
+sf::Vector2f ReplayInput::getPlayerStart() const {
+    return sf::Vector2f(header.playerStartX, header.playerStartY);
+}
+
+std::uint32_t ReplayInput::getAsteroidCount() const {
+    return header.asteroids;
+}
+
+std::uint64_t ReplayInput::getTickCount() const {
+    return ticks.size();
+}
+
+bool ReplayInput::isFinished() const {
+    return next >= ticks.size();
+}
+
+TickInput ReplayInput::nextTick() {
+    if (isFinished()) return TickInput();
+    return ticks[next++].input;
+}
+
+sf::Vector2f ReplayInput::getWorldSize() const {
+    if (next == 0) return getInitialWorldSize();
+    return ticks[next - 1].worldSize;
+}
+
+bool ReplayInput::verify(std::uint32_t checksum) {
+    if (next == 0 || next > ticks.size()) return true;
+    if (ticks[next - 1].checksum == checksum) return true;
+    if (!diverged) {
+        diverged = true;
+        divergedTick = next - 1;
+    }
+    return false;
+}
+
+bool ReplayInput::hasDiverged() const {
+    return diverged;
+}
+
+std::uint64_t ReplayInput::getDivergedTick() const {
+    return divergedTick;
+}
@@ -0,0 +1,178 @@
+#include "JobSystem.hpp"
+
+#include <algorithm>
+
+namespace {
+    constexpr int IDLE_SPINS = 64; // Steal attempts before a worker goes to sleep
+
+    // Pool the current thread works for, and its deque there. Thread-locals
+    // are shared by every JobSystem, so the owner is checked before the index
+    // is used: another pool's worker is a stranger here.
+    thread_local const JobSystem* currentOwner = nullptr;
+    thread_local std::size_t currentQueue = 0;
+}
+
+bool JobSystem::WorkerQueue::pushBack(const Job& job) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (size == CAPACITY) return false;
+    jobs[(head + size) % CAPACITY] = job;
+    ++size;
+    return true;
+}
+
+bool JobSystem::WorkerQueue::popBack(Job& job) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (size == 0) return false;
+    --size;
+    job = jobs[(head + size) % CAPACITY];
+    return true;
+}
+
+bool JobSystem::WorkerQueue::popFront(Job& job) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (size == 0) return false;
+    job = jobs[head];
+    head = (head + 1) % CAPACITY;
+    --size;
+    return true;
+}
+
+JobSystem::JobSystem(std::size_t threadCount)
+    : nextQueue(0), queuedJobs(0), stopping(false)
+{
+    if (threadCount == 0) {
+        threadCount = std::thread::hardware_concurrency();
+        if (threadCount == 0) threadCount = 1;
+    }
+    for (std::size_t i = 0; i < threadCount; ++i) {
+        queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    for (std::size_t i = 1; i < threadCount; ++i) {
+        workers.emplace_back(&JobSystem::workerLoop, this, i);
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wakeUp.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+std::size_t JobSystem::getThreadCount() const {
+    return queues.size();
+}
+
+void JobSystem::submitRaw(void (*run)(void*, std::size_t, std::size_t), void* context, std::size_t begin, std::size_t end,
+                          JobCounter& counter, JobCounter* dependency) {
+    counter.pending.fetch_add(1, std::memory_order_relaxed);
+    const Job job{run, context, begin, end, &counter};
+
+    if (dependency) {
+        // Checked under the lock the last job of the dependency takes, so the
+        // continuation can neither be missed nor released twice
+        std::unique_lock<std::mutex> lock(dependency->continuationMutex);
+        if (!dependency->isDone()) {
+            if (dependency->continuationCount < JobCounter::MAX_CONTINUATIONS) {
+                dependency->continuations[dependency->continuationCount++] = JobCounter::Continuation{run, context, &counter};
+                return;
+            }
+            // No room to park it: wait for the dependency right here
+            lock.unlock();
+            wait(*dependency);
+        }
+    }
+    push(job);
+}
+
+void JobSystem::push(const Job& job) {
+    // Spread jobs over every deque so workers start without stealing
+    const std::size_t target = nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+    if (!queues[target]->pushBack(job)) {
+        execute(job);
+        return;
+    }
+    queuedJobs.fetch_add(1, std::memory_order_release);
+    if (!workers.empty()) {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        wakeUp.notify_one();
+    }
+}
+
+void JobSystem::execute(const Job& job) {
+    job.run(job.context, job.begin, job.end);
+
+    // Copy the continuations out, since the counter may be destroyed as soon
+    // as the lock is released
+    JobCounter::Continuation released[JobCounter::MAX_CONTINUATIONS];
+    std::size_t releasedCount = 0;
+    {
+        JobCounter& counter = *job.counter;
+        std::lock_guard<std::mutex> lock(counter.continuationMutex);
+        if (counter.pending.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+        releasedCount = counter.continuationCount;
+        std::copy(counter.continuations, counter.continuations + releasedCount, released);
+        counter.continuationCount = 0;
+    }
+
+    for (std::size_t i = 0; i < releasedCount; ++i) {
+        const Job next{released[i].run, released[i].context, 0, 0, released[i].counter};
+        if (queues[ownQueue()]->pushBack(next)) {
+            queuedJobs.fetch_add(1, std::memory_order_release);
+        } else {
+            execute(next);
+        }
+    }
+    if (releasedCount > 0 && !workers.empty()) {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        wakeUp.notify_all();
+    }
+}
+
+bool JobSystem::tryRunOne(std::size_t self) {
+    Job job;
+    bool found = queues[self]->popBack(job);
+    for (std::size_t i = 1; !found && i < queues.size(); ++i) {
+        found = queues[(self + i) % queues.size()]->popFront(job);
+    }
+    if (!found) return false;
+    queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+    execute(job);
+    return true;
+}
+
+void JobSystem::wait(JobCounter& counter) {
+    while (!counter.isDone()) {
+        if (!tryRunOne(ownQueue())) std::this_thread::yield();
+    }
+    // The last job may still hold the lock; the counter must outlive that
+    std::lock_guard<std::mutex> lock(counter.continuationMutex);
+}
+
+// Strangers, like the creating thread, share deque 0; the deques are locked
+std::size_t JobSystem::ownQueue() const {
+    return currentOwner == this ? currentQueue : 0;
+}
+
+void JobSystem::workerLoop(std::size_t self) {
+    currentOwner = this;
+    currentQueue = self;
+    int idleSpins = 0;
+    while (!stopping.load(std::memory_order_acquire)) {
+        if (tryRunOne(self)) {
+            idleSpins = 0;
+            continue;
+        }
+        if (++idleSpins < IDLE_SPINS) {
+            std::this_thread::yield();
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wakeUp.wait(lock, [this] { return stopping.load() || queuedJobs.load(std::memory_order_acquire) > 0; });
+        idleSpins = 0;
+    }
+}
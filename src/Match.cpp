@@ -0,0 +1,114 @@
+#include "Match.hpp"
+#include "ShipControl.hpp"
+#include "JobSystem.hpp"
+
+#include <cmath>
+
+namespace {
+    // Ships spawn evenly around a ring about the world center
+    constexpr float SPAWN_RING_FRACTION = 0.35f; // Of the smaller world dimension
+    constexpr float PI = 3.14159265f;
+    constexpr float ANGLE_CORRECTION_DEG = 90.f;
+
+    constexpr std::size_t SHIP_JOB_GRAIN = 8;
+}
+
+MatchShip::MatchShip() : player(0.f, 0.f), attack(), attackToggle(false), active(false), incarnation(0) {}
+
+Match::Match(const sf::Vector2f& worldSize, std::size_t maxShips, std::size_t projectilesPerShip)
+    : worldSize(worldSize),
+      projectilesPerShip(projectilesPerShip),
+      ships(maxShips),
+      shipCount(0),
+      tickCount(0),
+      jobSystem(nullptr)
+{
+    for (MatchShip& ship : ships) {
+        // The default pool is sized for one player alone; a match holds many
+        ship.attack.setProjectilePool(projectilesPerShip, PoolOverflowPolicy::DropOldest);
+        ship.attack.setWorldSize(worldSize);
+    }
+}
+
+int Match::addShip() {
+    for (std::size_t id = 0; id < ships.size(); ++id) {
+        MatchShip& ship = ships[id];
+        if (ship.active) continue;
+
+        ship.player = Player(0.f, 0.f);
+        ship.player.setPosition(spawnPoint(id));
+        ship.attack.setProjectilePool(projectilesPerShip, PoolOverflowPolicy::DropOldest);
+        ship.attackToggle = false;
+        ship.input = TickInput();
+        ship.active = true;
+        ++ship.incarnation;
+        ++shipCount;
+        return static_cast<int>(id);
+    }
+    return -1;
+}
+
+void Match::removeShip(std::size_t id) {
+    if (id >= ships.size() || !ships[id].active) return;
+    ships[id].active = false;
+    ships[id].attack.setProjectilePool(projectilesPerShip, PoolOverflowPolicy::DropOldest);
+    --shipCount;
+}
+
+void Match::setInput(std::size_t id, const TickInput& input) {
+    if (id < ships.size()) {
+        ships[id].input = input;
+    }
+}
+
+void Match::step(float tickDelta) {
+    auto stepRange = [this, tickDelta](std::size_t begin, std::size_t end) { stepShips(begin, end, tickDelta); };
+    if (jobSystem) {
+        jobSystem->parallelFor(ships.size(), SHIP_JOB_GRAIN, stepRange);
+    } else {
+        stepRange(0, ships.size());
+    }
+    ++tickCount;
+}
+
+void Match::stepShips(std::size_t begin, std::size_t end, float tickDelta) {
+    for (std::size_t id = begin; id < end; ++id) {
+        MatchShip& ship = ships[id];
+        if (!ship.active) continue;
+
+        ship.player.storePreviousState();
+        const float rotationApplied = applyShipControls(ship.player, ship.input, tickDelta);
+        applyShipAttack(ship.player, ship.attack, ship.attackToggle, ship.input, tickDelta, rotationApplied, worldSize);
+        ship.input.toggleAttack = false; // An edge; held inputs repeat until replaced
+    }
+}
+
+sf::Vector2f Match::spawnPoint(std::size_t id) const {
+    const float angleRad = (360.f * id / ships.size() - ANGLE_CORRECTION_DEG) * PI / 180.f;
+    const float radius = SPAWN_RING_FRACTION * std::fmin(worldSize.x, worldSize.y);
+    return sf::Vector2f(worldSize.x / 2.f + std::cos(angleRad) * radius, worldSize.y / 2.f + std::sin(angleRad) * radius);
+}
+
+void Match::setJobSystem(JobSystem* jobs) {
+    jobSystem = jobs;
+}
+
+std::size_t Match::getShipCapacity() const {
+    return ships.size();
+}
+
+std::size_t Match::getShipCount() const {
+    return shipCount;
+}
+
+const MatchShip& Match::getShip(std::size_t id) const {
+    return ships[id];
+}
+
+sf::Vector2f Match::getWorldSize() const {
+    return worldSize;
+}
+
+std::uint64_t Match::getTickCount() const {
+    return tickCount;
+}
@@ -0,0 +1,280 @@
+#include "NetClient.hpp"
+#include "ShipControl.hpp"
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Sleep.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr float CONNECT_RETRY_S = 0.1f;
+    constexpr float HANDSHAKE_POLL_MS = 1.f;
+    constexpr int DISCONNECT_REPEATS = 3; // Unacknowledged, so send a few; the server times out the rest
+
+    static_assert(NET_MAX_SNAPSHOT_FRAGMENTS <= 64, "Fragments are tracked in a 64-bit mask");
+}
+
+NetClient::NetClient()
+    : serverPort(0),
+      connected(false),
+      shipId(0),
+      tickRate(0.f),
+      predicted(0.f, 0.f),
+      predicting(false),
+      nextInputSeq(0),
+      newestTick(NET_NO_TICK),
+      fragmentTick(NET_NO_TICK),
+      fragmentCount(0),
+      fragmentsMissing(0),
+      fragmentBytesUsed(0),
+      receiveBuffer(sf::UdpSocket::MaxDatagramSize) {}
+
+bool NetClient::connect(const sf::IpAddress& address, unsigned short port, sf::Time timeout) {
+    disconnect();
+    if (socket.bind(sf::Socket::AnyPort) != sf::Socket::Done) return false;
+    socket.setBlocking(false);
+    serverAddress = address;
+    serverPort = port;
+
+    packet.clear();
+    NetWriter out(packet);
+    out.header(NetMessage::Connect);
+    out.u8(NET_PROTOCOL_VERSION);
+
+    sf::Clock clock;
+    sf::Time nextAttempt = sf::Time::Zero;
+    while (clock.getElapsedTime() < timeout) {
+        if (clock.getElapsedTime() >= nextAttempt) {
+            send(packet);
+            nextAttempt = clock.getElapsedTime() + sf::seconds(CONNECT_RETRY_S);
+        }
+
+        std::size_t received = 0;
+        sf::IpAddress sender;
+        unsigned short senderPort = 0;
+        while (socket.receive(receiveBuffer.data(), receiveBuffer.size(), received, sender, senderPort) == sf::Socket::Done) {
+            stats.bytesReceived += received;
+            NetReader reader(receiveBuffer.data(), received);
+            NetMessage message;
+            if (!reader.header(message)) continue;
+            if (message == NetMessage::Reject) return false;
+            if (message != NetMessage::Accept) continue;
+
+            shipId = reader.u8();
+            tickRate = reader.u16();
+            const float width = reader.u16();
+            const float height = reader.u16();
+            reader.u32(); // Server tick; snapshots carry their own
+            if (!reader.ok() || tickRate <= 0.f) return false;
+            worldSize = sf::Vector2f(width, height);
+            connected = true;
+            return true;
+        }
+        sf::sleep(sf::milliseconds(static_cast<sf::Int32>(HANDSHAKE_POLL_MS)));
+    }
+    return false;
+}
+
+void NetClient::disconnect() {
+    if (connected) {
+        packet.clear();
+        NetWriter out(packet);
+        out.header(NetMessage::Disconnect);
+        for (int i = 0; i < DISCONNECT_REPEATS; ++i) {
+            send(packet);
+        }
+    }
+    socket.unbind();
+    connected = false;
+    predicting = false;
+    nextInputSeq = 0;
+    newestTick = NET_NO_TICK;
+    fragmentTick = NET_NO_TICK;
+    for (NetWorldState& state : states) {
+        state.clear();
+    }
+}
+
+bool NetClient::isConnected() const {
+    return connected;
+}
+
+void NetClient::receive() {
+    if (!connected) return;
+    std::size_t received = 0;
+    sf::IpAddress sender;
+    unsigned short senderPort = 0;
+    while (socket.receive(receiveBuffer.data(), receiveBuffer.size(), received, sender, senderPort) == sf::Socket::Done) {
+        if (senderPort != serverPort || sender != serverAddress) continue;
+        stats.bytesReceived += received;
+        NetReader reader(receiveBuffer.data(), received);
+        NetMessage message;
+        if (!reader.header(message)) continue;
+        if (message == NetMessage::Snapshot) {
+            handleSnapshot(reader);
+        } else if (message == NetMessage::Reject &&
+                   reader.u8() == static_cast<std::uint8_t>(NetRejectReason::SnapshotTooLarge)) {
+            ++stats.rejectedSnapshots;
+        }
+    }
+}
+
+void NetClient::handleSnapshot(NetReader& reader) {
+    const std::uint32_t tick = reader.u32();
+    const std::uint32_t baselineTick = reader.u32();
+    const std::uint32_t lastAppliedSeq = reader.u32();
+    const std::uint16_t serverTickUs = reader.u16();
+    const std::size_t fragment = reader.u8();
+    const std::size_t fragments = reader.u8();
+    if (!reader.ok() || fragments == 0 || fragments > NET_MAX_SNAPSHOT_FRAGMENTS || fragment >= fragments) {
+        ++stats.snapshotsReceived;
+        ++stats.undecodableSnapshots;
+        return;
+    }
+    if (newestTick != NET_NO_TICK && static_cast<std::int32_t>(tick - newestTick) <= 0) {
+        if (fragment == 0) ++stats.staleSnapshots; // Count each snapshot once
+        return;
+    }
+    if (fragments == 1) {
+        applySnapshot(tick, baselineTick, lastAppliedSeq, serverTickUs, reader);
+        return;
+    }
+
+    // Every fragment but the last is full size, so each has a fixed place
+    if (tick != fragmentTick) {
+        if (fragmentTick != NET_NO_TICK && static_cast<std::int32_t>(tick - fragmentTick) < 0) return; // Superseded
+        fragmentTick = tick;
+        fragmentCount = fragments;
+        fragmentsMissing = fragments == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << fragments) - 1;
+        fragmentBytesUsed = 0;
+        fragmentBytes.resize(fragments * NET_SNAPSHOT_FRAGMENT_BYTES);
+    }
+    const std::uint64_t bit = std::uint64_t(1) << fragment;
+    if (!(fragmentsMissing & bit)) return; // Duplicate
+    const std::size_t size = reader.remaining();
+    const bool last = fragment + 1 == fragments;
+    if (fragments != fragmentCount || size > NET_SNAPSHOT_FRAGMENT_BYTES || (!last && size != NET_SNAPSHOT_FRAGMENT_BYTES)) {
+        fragmentTick = NET_NO_TICK;
+        ++stats.snapshotsReceived;
+        ++stats.undecodableSnapshots;
+        return;
+    }
+    std::copy_n(reader.bytes(size), size, fragmentBytes.data() + fragment * NET_SNAPSHOT_FRAGMENT_BYTES);
+    if (last) fragmentBytesUsed = fragment * NET_SNAPSHOT_FRAGMENT_BYTES + size;
+    fragmentsMissing &= ~bit;
+    if (fragmentsMissing != 0) return;
+
+    fragmentTick = NET_NO_TICK;
+    ++stats.reassembledSnapshots;
+    NetReader delta(fragmentBytes.data(), fragmentBytesUsed);
+    applySnapshot(tick, baselineTick, lastAppliedSeq, serverTickUs, delta);
+}
+
+void NetClient::applySnapshot(std::uint32_t tick, std::uint32_t baselineTick, std::uint32_t lastAppliedSeq,
+                              std::uint16_t serverTickUs, NetReader& reader) {
+    ++stats.snapshotsReceived;
+    const NetWorldState* baseline = nullptr;
+    if (baselineTick != NET_NO_TICK) {
+        baseline = &states[baselineTick % NET_SNAPSHOT_HISTORY];
+        if (baseline->tick != baselineTick || tick - baselineTick >= NET_SNAPSHOT_HISTORY) {
+            ++stats.undecodableSnapshots;
+            return;
+        }
+    }
+
+    NetWorldState& state = states[tick % NET_SNAPSHOT_HISTORY];
+    state.tick = tick;
+    if (!decodeWorldDelta(reader, baseline, state)) {
+        state.clear();
+        ++stats.undecodableSnapshots;
+        return;
+    }
+    newestTick = tick;
+    stats.serverTickUs = serverTickUs;
+    if (!baseline) ++stats.fullSnapshots;
+
+    if (const NetShipState* ship = state.findShip(shipId)) {
+        reconcile(*ship, lastAppliedSeq);
+    }
+}
+
+void NetClient::reconcile(const NetShipState& ship, std::uint32_t lastAppliedSeq) {
+    const sf::Vector2f before = predicted.getPosition();
+
+    // Rewind to the server's ship, then redo what it hasn't seen yet
+    applyShipState(ship, predicted);
+    const std::uint32_t firstUnapplied = lastAppliedSeq == NET_NO_TICK ? 0 : lastAppliedSeq + 1;
+    if (nextInputSeq - firstUnapplied <= INPUT_HISTORY) {
+        const float tickDelta = 1.f / tickRate;
+        for (std::uint32_t seq = firstUnapplied; seq != nextInputSeq; ++seq) {
+            applyShipControls(predicted, inputHistory[seq % INPUT_HISTORY], tickDelta);
+        }
+    }
+
+    if (!predicting) {
+        predicting = true; // Nothing was predicted before the first snapshot
+        return;
+    }
+    const sf::Vector2f offset = predicted.getPosition() - before;
+    const float error = std::sqrt(offset.x * offset.x + offset.y * offset.y);
+    stats.lastPredictionError = error;
+    stats.maxPredictionError = std::max(stats.maxPredictionError, error);
+    stats.totalPredictionError += error;
+    if (error > 1.f / NET_POSITION_SCALE) ++stats.corrections; // More than quantization
+}
+
+void NetClient::sendInput(const TickInput& input) {
+    if (!connected) return;
+
+    predicted.storePreviousState();
+    applyShipControls(predicted, input, 1.f / tickRate);
+    inputHistory[nextInputSeq % INPUT_HISTORY] = input;
+    const std::uint32_t seq = nextInputSeq++;
+
+    packet.clear();
+    NetWriter out(packet);
+    out.header(NetMessage::Input);
+    out.u32(newestTick);
+    out.u32(seq);
+    const std::size_t count = std::min<std::size_t>(NET_INPUT_REDUNDANCY, seq + 1);
+    out.u8(static_cast<std::uint8_t>(count));
+    for (std::size_t i = 0; i < count; ++i) {
+        out.u8(packInput(inputHistory[(seq - i) % INPUT_HISTORY]));
+    }
+    send(packet);
+}
+
+void NetClient::send(const std::vector<std::uint8_t>& data) {
+    if (socket.send(data.data(), data.size(), serverAddress, serverPort) == sf::Socket::Done) {
+        stats.bytesSent += data.size();
+    }
+}
+
+std::uint8_t NetClient::getShipId() const {
+    return shipId;
+}
+
+float NetClient::getTickRate() const {
+    return tickRate;
+}
+
+sf::Vector2f NetClient::getWorldSize() const {
+    return worldSize;
+}
+
+const Player& NetClient::getPredictedPlayer() const {
+    return predicted;
+}
+
+const NetWorldState& NetClient::getWorldState() const {
+    return newestTick != NET_NO_TICK ? states[newestTick % NET_SNAPSHOT_HISTORY] : emptyState;
+}
+
+NetClientStats NetClient::getStats() const {
+    return stats;
+}
+
+void NetClient::resetStats() {
+    stats = NetClientStats();
+}
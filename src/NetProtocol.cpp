@@ -0,0 +1,522 @@
+#include "NetProtocol.hpp"
+#include "Match.hpp"
+#include "Player.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstdint>
+
+namespace {
+    // Input bits, same layout as recordings
+    constexpr std::uint8_t INPUT_ROTATE_LEFT = 1 << 0;
+    constexpr std::uint8_t INPUT_ROTATE_RIGHT = 1 << 1;
+    constexpr std::uint8_t INPUT_FAST_ROTATE = 1 << 2;
+    constexpr std::uint8_t INPUT_MOVE_FORWARD = 1 << 3;
+    constexpr std::uint8_t INPUT_TOGGLE_ATTACK = 1 << 4;
+
+    // Ship field mask bits
+    constexpr std::uint8_t SHIP_X = 1 << 0;
+    constexpr std::uint8_t SHIP_Y = 1 << 1;
+    constexpr std::uint8_t SHIP_VELOCITY_X = 1 << 2;
+    constexpr std::uint8_t SHIP_VELOCITY_Y = 1 << 3;
+    constexpr std::uint8_t SHIP_ROTATION = 1 << 4;
+    constexpr std::uint8_t SHIP_FLAGS = 1 << 5;
+    constexpr std::uint8_t SHIP_SPAWNED = 1 << 7; // Not in the baseline; fields are absolute
+
+    constexpr float FULL_TURN_DEG = 360.f;
+    constexpr float ROTATION_STEPS = 65536.f;
+    constexpr float QUANTIZED_LIMIT = 1.0e9f; // Keeps far-flung ships inside int32
+
+    // Sanity limits for decoding untrusted datagrams
+    constexpr std::uint32_t MAX_SHIPS = 256;
+    constexpr std::uint32_t MAX_NEW_PROJECTILES = 65536;
+
+    std::int32_t quantize(float value, float scale) {
+        const float scaled = std::max(-QUANTIZED_LIMIT, std::min(QUANTIZED_LIMIT, value * scale));
+        return static_cast<std::int32_t>(std::lround(scaled));
+    }
+
+    constexpr std::int32_t PROJECTILE_ONE = 1 << NET_PROJECTILE_FRACTION_BITS;
+    constexpr std::int32_t PROJECTILE_DRIFT_LIMIT = PROJECTILE_ONE / 2; // Half a position unit
+
+    // Where a projectile moving in a straight line is `ticks` after the baseline
+    std::int32_t extrapolate(std::int32_t position, std::int32_t velocity, std::uint32_t ticks) {
+        return static_cast<std::int32_t>(position + static_cast<std::int64_t>(velocity) * ticks);
+    }
+
+    bool bitSet(const std::uint8_t* bits, std::size_t index) {
+        return (bits[index / 8] >> (index % 8)) & 1u;
+    }
+
+    // Packs one bit per call into bytes, lowest bit first
+    class BitPacker {
+    public:
+        explicit BitPacker(NetWriter& out) : out(out), current(0), used(0) {}
+        void push(bool bit) {
+            current |= static_cast<std::uint8_t>(bit ? 1u : 0u) << used;
+            if (++used == 8) flush();
+        }
+        void finish() {
+            if (used > 0) flush();
+        }
+
+    private:
+        void flush() {
+            out.u8(current);
+            current = 0;
+            used = 0;
+        }
+
+        NetWriter& out;
+        std::uint8_t current;
+        int used;
+    };
+
+    // Calls fn(baselineIndex, currentIndex) for each baseline projectile that
+    // is still alive, and returns the first current index that is new. Pools
+    // keep projectiles in spawn order, so survivors appear in the same order.
+    template <typename Fn>
+    std::size_t forEachSurvivor(const std::uint64_t* currentIds, std::size_t currentFirst, std::size_t currentEnd,
+                                const std::uint64_t* baselineIds, std::size_t baselineFirst, std::size_t baselineEnd, Fn&& fn) {
+        std::size_t c = currentFirst;
+        for (std::size_t b = baselineFirst; b < baselineEnd; ++b) {
+            if (c < currentEnd && currentIds[c] == baselineIds[b]) {
+                fn(b, c);
+                ++c;
+            }
+        }
+        return c;
+    }
+
+    // New projectiles, relative to their ship. Freshly fired ones sit on whole
+    // position units and take the short form; the low bit marks the rest.
+    void writeSpawnCoordinate(NetWriter& out, std::int32_t value, std::int32_t shipUnits) {
+        const std::int64_t offset = value - static_cast<std::int64_t>(shipUnits) * PROJECTILE_ONE;
+        out.svarint(offset % PROJECTILE_ONE == 0 ? offset / PROJECTILE_ONE * 2 : offset * 2 + 1);
+    }
+
+    std::int32_t readSpawnCoordinate(NetReader& in, std::int32_t shipUnits) {
+        const std::int64_t coded = in.svarint64();
+        const std::int64_t offset = coded % 2 != 0 ? (coded - 1) / 2 : coded / 2 * PROJECTILE_ONE;
+        return static_cast<std::int32_t>(static_cast<std::int64_t>(shipUnits) * PROJECTILE_ONE + offset);
+    }
+
+    bool predictsExactly(const NetProjectileState& base, const NetProjectileState& now, std::uint32_t ticks) {
+        return extrapolate(base.x, base.velocityX, ticks) == now.x && extrapolate(base.y, base.velocityY, ticks) == now.y;
+    }
+
+    void encodeProjectiles(const NetWorldState& current, std::size_t shipIndex,
+                           const NetWorldState* baseline, std::size_t baselineShipIndex, NetWriter& out) {
+        const NetShipState& ship = current.ships[shipIndex];
+        const std::size_t currentFirst = current.firstProjectile[shipIndex];
+        const std::size_t currentEnd = current.firstProjectile[shipIndex + 1];
+        std::size_t firstNew = currentFirst;
+
+        if (baseline) {
+            const std::size_t baselineFirst = baseline->firstProjectile[baselineShipIndex];
+            const std::size_t baselineEnd = baseline->firstProjectile[baselineShipIndex + 1];
+            const std::uint32_t ticks = current.tick - baseline->tick;
+
+            // Which baseline projectiles survived
+            BitPacker alive(out);
+            std::size_t c = currentFirst;
+            for (std::size_t b = baselineFirst; b < baselineEnd; ++b) {
+                const bool survived = c < currentEnd && current.projectileIds[c] == baseline->projectileIds[b];
+                alive.push(survived);
+                if (survived) ++c;
+            }
+            alive.finish();
+
+            // Which survivors aren't where extrapolation puts them, then by how much
+            BitPacker corrected(out);
+            const std::uint64_t* currentIds = current.projectileIds.data();
+            const std::uint64_t* baselineIds = baseline->projectileIds.data();
+            firstNew = forEachSurvivor(currentIds, currentFirst, currentEnd, baselineIds, baselineFirst, baselineEnd,
+                [&](std::size_t b, std::size_t c) {
+                    corrected.push(!predictsExactly(baseline->projectiles[b], current.projectiles[c], ticks));
+                });
+            corrected.finish();
+            forEachSurvivor(currentIds, currentFirst, currentEnd, baselineIds, baselineFirst, baselineEnd,
+                [&](std::size_t b, std::size_t c) {
+                    const NetProjectileState& base = baseline->projectiles[b];
+                    const NetProjectileState& now = current.projectiles[c];
+                    if (!predictsExactly(base, now, ticks)) {
+                        out.svarint(now.x - extrapolate(base.x, base.velocityX, ticks));
+                        out.svarint(now.y - extrapolate(base.y, base.velocityY, ticks));
+                    }
+                });
+        }
+
+        // Spawned since the baseline
+        out.varint(static_cast<std::uint32_t>(currentEnd - firstNew));
+        for (std::size_t c = firstNew; c < currentEnd; ++c) {
+            const NetProjectileState& projectile = current.projectiles[c];
+            writeSpawnCoordinate(out, projectile.x, ship.x);
+            writeSpawnCoordinate(out, projectile.y, ship.y);
+            out.svarint(projectile.velocityX);
+            out.svarint(projectile.velocityY);
+        }
+    }
+
+    bool decodeProjectiles(NetReader& in, const NetShipState& ship, const NetWorldState* baseline,
+                           std::size_t baselineShipIndex, NetWorldState& out) {
+        if (baseline) {
+            const std::size_t baselineFirst = baseline->firstProjectile[baselineShipIndex];
+            const std::size_t baselineCount = baseline->projectileCount(baselineShipIndex);
+            const std::uint32_t ticks = out.tick - baseline->tick;
+
+            const std::uint8_t* alive = in.bytes((baselineCount + 7) / 8);
+            if (!alive) return false;
+            std::size_t survivors = 0;
+            for (std::size_t i = 0; i < baselineCount; ++i) {
+                survivors += bitSet(alive, i) ? 1 : 0;
+            }
+            const std::uint8_t* corrected = in.bytes((survivors + 7) / 8);
+            if (!corrected) return false;
+
+            std::size_t survivor = 0;
+            for (std::size_t i = 0; i < baselineCount; ++i) {
+                if (!bitSet(alive, i)) continue;
+                const NetProjectileState& base = baseline->projectiles[baselineFirst + i];
+                NetProjectileState projectile = base;
+                projectile.x = extrapolate(base.x, base.velocityX, ticks);
+                projectile.y = extrapolate(base.y, base.velocityY, ticks);
+                if (bitSet(corrected, survivor++)) {
+                    projectile.x += in.svarint();
+                    projectile.y += in.svarint();
+                }
+                out.projectiles.push_back(projectile);
+            }
+        }
+
+        const std::uint32_t spawned = in.varint();
+        if (spawned > MAX_NEW_PROJECTILES) return false;
+        for (std::uint32_t i = 0; i < spawned && in.ok(); ++i) {
+            NetProjectileState projectile;
+            projectile.x = readSpawnCoordinate(in, ship.x);
+            projectile.y = readSpawnCoordinate(in, ship.y);
+            projectile.velocityX = in.svarint();
+            projectile.velocityY = in.svarint();
+            out.projectiles.push_back(projectile);
+        }
+        return in.ok();
+    }
+}
+
+// --- NetWorldState ---
+void NetWorldState::clear() {
+    tick = NET_NO_TICK;
+    ships.clear();
+    firstProjectile.clear();
+    projectiles.clear();
+    projectileIds.clear();
+}
+
+std::size_t NetWorldState::projectileCount(std::size_t shipIndex) const {
+    return firstProjectile[shipIndex + 1] - firstProjectile[shipIndex];
+}
+
+const NetShipState* NetWorldState::findShip(std::uint8_t id) const {
+    auto found = std::lower_bound(ships.begin(), ships.end(), id,
+        [](const NetShipState& ship, std::uint8_t value) { return ship.id < value; });
+    return found != ships.end() && found->id == id ? &*found : nullptr;
+}
+
+// --- NetWriter ---
+NetWriter::NetWriter(std::vector<std::uint8_t>& buffer) : buffer(buffer) {}
+
+void NetWriter::u8(std::uint8_t value) {
+    buffer.push_back(value);
+}
+
+void NetWriter::u16(std::uint16_t value) {
+    u8(static_cast<std::uint8_t>(value));
+    u8(static_cast<std::uint8_t>(value >> 8));
+}
+
+void NetWriter::u32(std::uint32_t value) {
+    u16(static_cast<std::uint16_t>(value));
+    u16(static_cast<std::uint16_t>(value >> 16));
+}
+
+void NetWriter::varint(std::uint64_t value) {
+    while (value >= 0x80) {
+        u8(static_cast<std::uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    u8(static_cast<std::uint8_t>(value));
+}
+
+void NetWriter::svarint(std::int64_t value) {
+    const std::uint64_t bits = static_cast<std::uint64_t>(value);
+    varint((bits << 1) ^ (value < 0 ? ~std::uint64_t(0) : 0u));
+}
+
+void NetWriter::bytes(const std::uint8_t* data, std::size_t count) {
+    buffer.insert(buffer.end(), data, data + count);
+}
+
+void NetWriter::header(NetMessage message) {
+    u16(NET_PROTOCOL_ID);
+    u8(static_cast<std::uint8_t>(message));
+}
+
+std::size_t NetWriter::size() const {
+    return buffer.size();
+}
+
+// --- NetReader ---
+NetReader::NetReader(const std::uint8_t* data, std::size_t size) : data(data), size(size), offset(0), failed(false) {}
+
+std::uint8_t NetReader::u8() {
+    if (offset >= size) {
+        failed = true;
+        return 0;
+    }
+    return data[offset++];
+}
+
+std::uint16_t NetReader::u16() {
+    const std::uint16_t low = u8();
+    return static_cast<std::uint16_t>(low | (u8() << 8));
+}
+
+std::uint32_t NetReader::u32() {
+    const std::uint32_t low = u16();
+    return low | (static_cast<std::uint32_t>(u16()) << 16);
+}
+
+std::uint32_t NetReader::varint() {
+    const std::uint64_t value = varint64();
+    if (value > 0xFFFFFFFFu) failed = true;
+    return failed ? 0 : static_cast<std::uint32_t>(value);
+}
+
+std::int32_t NetReader::svarint() {
+    const std::int64_t value = svarint64();
+    if (value < INT32_MIN || value > INT32_MAX) failed = true;
+    return failed ? 0 : static_cast<std::int32_t>(value);
+}
+
+std::uint64_t NetReader::varint64() {
+    std::uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        const std::uint8_t byte = u8();
+        value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return value;
+    }
+    failed = true; // Longer than any 64-bit value
+    return 0;
+}
+
+std::int64_t NetReader::svarint64() {
+    const std::uint64_t bits = varint64();
+    return static_cast<std::int64_t>((bits >> 1) ^ (0u - (bits & 1u)));
+}
+
+const std::uint8_t* NetReader::bytes(std::size_t count) {
+    if (size - offset < count) {
+        failed = true;
+        return nullptr;
+    }
+    const std::uint8_t* start = data + offset;
+    offset += count;
+    return start;
+}
+
+bool NetReader::header(NetMessage& message) {
+    const std::uint16_t protocol = u16();
+    message = static_cast<NetMessage>(u8());
+    return ok() && protocol == NET_PROTOCOL_ID;
+}
+
+bool NetReader::ok() const {
+    return !failed;
+}
+
+bool NetReader::atEnd() const {
+    return offset == size;
+}
+
+std::size_t NetReader::remaining() const {
+    return size - offset;
+}
+
+// --- Inputs ---
+std::uint8_t packInput(const TickInput& input) {
+    std::uint8_t bits = 0;
+    if (input.rotateLeft) bits |= INPUT_ROTATE_LEFT;
+    if (input.rotateRight) bits |= INPUT_ROTATE_RIGHT;
+    if (input.fastRotate) bits |= INPUT_FAST_ROTATE;
+    if (input.moveForward) bits |= INPUT_MOVE_FORWARD;
+    if (input.toggleAttack) bits |= INPUT_TOGGLE_ATTACK;
+    return bits;
+}
+
+TickInput unpackInput(std::uint8_t bits) {
+    TickInput input;
+    input.rotateLeft = (bits & INPUT_ROTATE_LEFT) != 0;
+    input.rotateRight = (bits & INPUT_ROTATE_RIGHT) != 0;
+    input.fastRotate = (bits & INPUT_FAST_ROTATE) != 0;
+    input.moveForward = (bits & INPUT_MOVE_FORWARD) != 0;
+    input.toggleAttack = (bits & INPUT_TOGGLE_ATTACK) != 0;
+    return input;
+}
+
+// --- Quantized state ---
+void captureWorldState(const Match& match, float tickDelta, const NetWorldState& previous, NetWorldState& out) {
+    out.clear();
+    out.tick = static_cast<std::uint32_t>(match.getTickCount());
+    const float projectileScale = NET_POSITION_SCALE * PROJECTILE_ONE;
+    const float projectileVelocityScale = tickDelta * projectileScale;
+    const std::uint32_t ticksSincePrevious = out.tick - previous.tick;
+
+    std::size_t p = 0; // Previous ships are in id order too
+    for (std::size_t id = 0; id < match.getShipCapacity(); ++id) {
+        const MatchShip& ship = match.getShip(id);
+        if (!ship.active) continue;
+
+        NetShipState state;
+        state.id = static_cast<std::uint8_t>(id);
+        state.x = quantize(ship.player.getPosition().x, NET_POSITION_SCALE);
+        state.y = quantize(ship.player.getPosition().y, NET_POSITION_SCALE);
+        state.velocityX = quantize(ship.player.getVelocity().x, NET_VELOCITY_SCALE);
+        state.velocityY = quantize(ship.player.getVelocity().y, NET_VELOCITY_SCALE);
+        state.rotation = static_cast<std::uint16_t>(std::lround(ship.player.getRotation() / FULL_TURN_DEG * ROTATION_STEPS));
+        state.flags = ship.attackToggle ? NET_SHIP_ATTACKING : 0;
+        state.incarnation = ship.incarnation;
+        out.ships.push_back(state);
+
+        const std::size_t first = out.projectiles.size();
+        out.firstProjectile.push_back(static_cast<std::uint32_t>(first));
+        const ProjectileStore& projectiles = ship.attack.getProjectiles();
+        for (std::size_t i = 0; i < projectiles.size(); ++i) {
+            NetProjectileState projectile;
+            projectile.x = quantize(projectiles.positionsX()[i], projectileScale);
+            projectile.y = quantize(projectiles.positionsY()[i], projectileScale);
+            projectile.velocityX = quantize(projectiles.velocitiesX()[i], projectileVelocityScale);
+            projectile.velocityY = quantize(projectiles.velocitiesY()[i], projectileVelocityScale);
+            out.projectiles.push_back(projectile);
+
+            const ProjectileHandle handle = projectiles.handleAt(i);
+            out.projectileIds.push_back((static_cast<std::uint64_t>(handle.generation) << 32) | handle.slot);
+        }
+
+        while (p < previous.ships.size() && previous.ships[p].id < state.id) ++p;
+        const bool wasCaptured = p < previous.ships.size() && previous.ships[p].id == state.id &&
+                                 previous.ships[p].incarnation == state.incarnation;
+        const std::size_t end = out.projectiles.size();
+        std::size_t firstNew = first;
+        if (wasCaptured) {
+            // Keep last tick's trajectory while it's close enough to the real one
+            firstNew = forEachSurvivor(out.projectileIds.data(), first, end, previous.projectileIds.data(),
+                                       previous.firstProjectile[p], previous.firstProjectile[p + 1],
+                [&](std::size_t b, std::size_t c) {
+                    const NetProjectileState& before = previous.projectiles[b];
+                    NetProjectileState& now = out.projectiles[c];
+                    const std::int32_t x = extrapolate(before.x, before.velocityX, ticksSincePrevious);
+                    const std::int32_t y = extrapolate(before.y, before.velocityY, ticksSincePrevious);
+                    now.velocityX = before.velocityX;
+                    now.velocityY = before.velocityY;
+                    if (std::abs(x - now.x) <= PROJECTILE_DRIFT_LIMIT && std::abs(y - now.y) <= PROJECTILE_DRIFT_LIMIT) {
+                        now.x = x;
+                        now.y = y;
+                    }
+                });
+        }
+        // New projectiles start on whole units, so deltas can send them compactly
+        for (std::size_t c = firstNew; c < end; ++c) {
+            NetProjectileState& projectile = out.projectiles[c];
+            projectile.x = quantize(projectile.x / projectileScale, NET_POSITION_SCALE) * PROJECTILE_ONE;
+            projectile.y = quantize(projectile.y / projectileScale, NET_POSITION_SCALE) * PROJECTILE_ONE;
+        }
+    }
+    out.firstProjectile.push_back(static_cast<std::uint32_t>(out.projectiles.size()));
+}
+
+void applyShipState(const NetShipState& ship, Player& player) {
+    player.setPosition(dequantizePosition(ship.x, ship.y));
+    player.setVelocity(sf::Vector2f(ship.velocityX / NET_VELOCITY_SCALE, ship.velocityY / NET_VELOCITY_SCALE));
+    player.setRotation(ship.rotation * (FULL_TURN_DEG / ROTATION_STEPS));
+}
+
+sf::Vector2f dequantizePosition(std::int32_t x, std::int32_t y) {
+    return sf::Vector2f(x / NET_POSITION_SCALE, y / NET_POSITION_SCALE);
+}
+
+sf::Vector2f dequantizeProjectile(const NetProjectileState& projectile) {
+    const float scale = NET_POSITION_SCALE * PROJECTILE_ONE;
+    return sf::Vector2f(projectile.x / scale, projectile.y / scale);
+}
+
+// --- Delta coding ---
+void encodeWorldDelta(const NetWorldState& current, const NetWorldState* baseline, NetWriter& out) {
+    static const NetShipState NO_SHIP;
+
+    out.varint(static_cast<std::uint32_t>(current.ships.size()));
+    std::size_t b = 0; // Baseline ships are in id order too
+    for (std::size_t i = 0; i < current.ships.size(); ++i) {
+        const NetShipState& ship = current.ships[i];
+        while (baseline && b < baseline->ships.size() && baseline->ships[b].id < ship.id) ++b;
+        const bool inBaseline = baseline && b < baseline->ships.size() && baseline->ships[b].id == ship.id &&
+                                baseline->ships[b].incarnation == ship.incarnation;
+        const NetShipState& base = inBaseline ? baseline->ships[b] : NO_SHIP;
+
+        std::uint8_t mask = inBaseline ? 0 : SHIP_SPAWNED;
+        if (ship.x != base.x) mask |= SHIP_X;
+        if (ship.y != base.y) mask |= SHIP_Y;
+        if (ship.velocityX != base.velocityX) mask |= SHIP_VELOCITY_X;
+        if (ship.velocityY != base.velocityY) mask |= SHIP_VELOCITY_Y;
+        if (ship.rotation != base.rotation) mask |= SHIP_ROTATION;
+        if (ship.flags != base.flags) mask |= SHIP_FLAGS;
+
+        out.u8(ship.id);
+        out.u8(mask);
+        if (mask & SHIP_X) out.svarint(ship.x - base.x);
+        if (mask & SHIP_Y) out.svarint(ship.y - base.y);
+        if (mask & SHIP_VELOCITY_X) out.svarint(ship.velocityX - base.velocityX);
+        if (mask & SHIP_VELOCITY_Y) out.svarint(ship.velocityY - base.velocityY);
+        if (mask & SHIP_ROTATION) out.svarint(static_cast<std::int16_t>(ship.rotation - base.rotation)); // Shortest way round
+        if (mask & SHIP_FLAGS) out.u8(ship.flags);
+
+        encodeProjectiles(current, i, inBaseline ? baseline : nullptr, b, out);
+    }
+}
+
+bool decodeWorldDelta(NetReader& in, const NetWorldState* baseline, NetWorldState& out) {
+    static const NetShipState NO_SHIP;
+
+    const std::uint32_t tick = out.tick;
+    out.clear();
+    out.tick = tick;
+
+    const std::uint32_t shipCount = in.varint();
+    if (!in.ok() || shipCount > MAX_SHIPS) return false;
+    std::size_t b = 0;
+    for (std::uint32_t i = 0; i < shipCount; ++i) {
+        const std::uint8_t id = in.u8();
+        const std::uint8_t mask = in.u8();
+        if (!in.ok() || (!out.ships.empty() && id <= out.ships.back().id)) return false;
+
+        while (baseline && b < baseline->ships.size() && baseline->ships[b].id < id) ++b;
+        const bool inBaseline = !(mask & SHIP_SPAWNED);
+        if (inBaseline && !(baseline && b < baseline->ships.size() && baseline->ships[b].id == id)) return false;
+        const NetShipState& base = inBaseline ? baseline->ships[b] : NO_SHIP;
+
+        NetShipState ship = base;
+        ship.id = id;
+        if (mask & SHIP_X) ship.x += in.svarint();
+        if (mask & SHIP_Y) ship.y += in.svarint();
+        if (mask & SHIP_VELOCITY_X) ship.velocityX += in.svarint();
+        if (mask & SHIP_VELOCITY_Y) ship.velocityY += in.svarint();
+        if (mask & SHIP_ROTATION) ship.rotation = static_cast<std::uint16_t>(ship.rotation + in.svarint());
+        if (mask & SHIP_FLAGS) ship.flags = in.u8();
+        out.ships.push_back(ship);
+        out.firstProjectile.push_back(static_cast<std::uint32_t>(out.projectiles.size()));
+
+        if (!decodeProjectiles(in, ship, inBaseline ? baseline : nullptr, b, out)) return false;
+    }
+    out.firstProjectile.push_back(static_cast<std::uint32_t>(out.projectiles.size()));
+    return in.ok() && in.atEnd();
+}
@@ -0,0 +1,312 @@
+#include "NetServer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+namespace {
+    constexpr float CLIENT_TIMEOUT_S = 5.f;
+
+    // Inputs queued beyond this are skipped, so a client that got ahead
+    // doesn't play with ever-growing latency
+    constexpr std::uint32_t MAX_INPUT_BACKLOG = 6;
+    constexpr std::uint32_t INPUT_BACKLOG_TARGET = 2;
+
+    static_assert(NET_MAX_DATAGRAM_BYTES <= sf::UdpSocket::MaxDatagramSize, "Snapshot fragments must fit a datagram");
+
+    float percentile(std::vector<float>& values, float fraction) {
+        if (values.empty()) return 0.f;
+        const std::size_t index = static_cast<std::size_t>(fraction * (values.size() - 1));
+        std::nth_element(values.begin(), values.begin() + index, values.end());
+        return values[index];
+    }
+}
+
+NetServer::NetServer(const NetServerOptions& options)
+    : options(options),
+      tickDelta(1.f / options.tickRate),
+      match(options.worldSize, std::min<std::size_t>(options.maxClients, 256)),
+      clients(match.getShipCapacity()),
+      deltaCacheUsed(0),
+      receiveBuffer(sf::UdpSocket::MaxDatagramSize),
+      tickHistoryMs(),
+      tickHistoryHead(0),
+      tickHistoryCount(0),
+      lastTickUs(0)
+{
+    socket.setBlocking(false);
+}
+
+bool NetServer::start() {
+    if (socket.bind(options.port) != sf::Socket::Done) {
+        std::cerr << "Couldn't bind UDP port " << options.port << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void NetServer::tick() {
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point start = Clock::now();
+
+    receivePackets();
+    dropSilentClients();
+    applyInputs();
+    match.step(tickDelta);
+
+    const NetWorldState& previous = history[(match.getTickCount() - 1) % NET_SNAPSHOT_HISTORY];
+    NetWorldState& state = history[match.getTickCount() % NET_SNAPSHOT_HISTORY];
+    captureWorldState(match, tickDelta, previous, state);
+    sendSnapshots();
+
+    const float ms = std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+    tickHistoryMs[tickHistoryHead] = ms;
+    tickHistoryHead = (tickHistoryHead + 1) % TICK_HISTORY;
+    tickHistoryCount = std::min(tickHistoryCount + 1, TICK_HISTORY);
+    lastTickUs = static_cast<std::uint16_t>(std::min(ms * 1000.f, 65535.f));
+    ++stats.ticks;
+}
+
+void NetServer::receivePackets() {
+    std::size_t received = 0;
+    sf::IpAddress address;
+    unsigned short port = 0;
+    while (socket.receive(receiveBuffer.data(), receiveBuffer.size(), received, address, port) == sf::Socket::Done) {
+        stats.bytesReceived += received;
+        handlePacket(receiveBuffer.data(), received, address, port);
+    }
+}
+
+void NetServer::handlePacket(const std::uint8_t* data, std::size_t size, const sf::IpAddress& address, unsigned short port) {
+    NetReader reader(data, size);
+    NetMessage message;
+    if (!reader.header(message)) return;
+
+    if (message == NetMessage::Connect) {
+        handleConnect(reader, address, port);
+        return;
+    }
+
+    std::size_t id = 0;
+    Client* client = findClient(address, port, id);
+    if (!client) return;
+    client->lastHeardTick = match.getTickCount();
+
+    if (message == NetMessage::Input) {
+        handleInput(*client, reader);
+    } else if (message == NetMessage::Disconnect) {
+        client->connected = false;
+        match.removeShip(id);
+    }
+}
+
+void NetServer::handleConnect(NetReader& reader, const sf::IpAddress& address, unsigned short port) {
+    const std::uint8_t version = reader.u8();
+    packet.clear();
+    NetWriter out(packet);
+
+    if (!reader.ok() || version != NET_PROTOCOL_VERSION) {
+        out.header(NetMessage::Reject);
+        out.u8(static_cast<std::uint8_t>(NetRejectReason::BadVersion));
+        send(packet, address, port);
+        return;
+    }
+
+    // A repeated Connect means our Accept was lost; answer it again
+    std::size_t id = 0;
+    Client* client = findClient(address, port, id);
+    if (!client) {
+        const int ship = match.addShip();
+        if (ship < 0) {
+            out.header(NetMessage::Reject);
+            out.u8(static_cast<std::uint8_t>(NetRejectReason::ServerFull));
+            send(packet, address, port);
+            return;
+        }
+        id = static_cast<std::size_t>(ship);
+        client = &clients[id];
+        *client = Client();
+        client->inputSeqs.fill(NET_NO_TICK);
+        client->connected = true;
+        client->address = address;
+        client->port = port;
+        client->lastHeardTick = match.getTickCount();
+    }
+
+    out.header(NetMessage::Accept);
+    out.u8(static_cast<std::uint8_t>(id));
+    out.u16(static_cast<std::uint16_t>(options.tickRate));
+    out.u16(static_cast<std::uint16_t>(options.worldSize.x));
+    out.u16(static_cast<std::uint16_t>(options.worldSize.y));
+    out.u32(static_cast<std::uint32_t>(match.getTickCount()));
+    send(packet, address, port);
+}
+
+void NetServer::handleInput(Client& client, NetReader& reader) {
+    const std::uint32_t ackedTick = reader.u32();
+    const std::uint32_t newestSeq = reader.u32();
+    const std::uint8_t count = reader.u8();
+    const std::uint8_t* inputs = reader.bytes(count);
+    if (!inputs || count > NET_INPUT_REDUNDANCY) return;
+
+    // Packets can arrive out of order; only ever move the ack forward
+    if (ackedTick != NET_NO_TICK && (client.ackedTick == NET_NO_TICK || static_cast<std::int32_t>(ackedTick - client.ackedTick) > 0)) {
+        client.ackedTick = ackedTick;
+    }
+    for (std::uint8_t i = 0; i < count; ++i) {
+        if (i > newestSeq) break; // Before the first input
+        const std::uint32_t seq = newestSeq - i;
+        if (seq < client.nextInputSeq) break; // Already applied
+        client.inputSeqs[seq % INPUT_BUFFER] = seq;
+        client.inputs[seq % INPUT_BUFFER] = unpackInput(inputs[i]);
+    }
+    if (client.newestInputSeq == NET_NO_TICK || newestSeq > client.newestInputSeq) {
+        client.newestInputSeq = newestSeq;
+    }
+}
+
+NetServer::Client* NetServer::findClient(const sf::IpAddress& address, unsigned short port, std::size_t& id) {
+    for (id = 0; id < clients.size(); ++id) {
+        if (clients[id].connected && clients[id].port == port && clients[id].address == address) {
+            return &clients[id];
+        }
+    }
+    return nullptr;
+}
+
+// One input per client per tick. A client whose next input hasn't arrived
+// keeps flying on its last one; the snapshot's input seq tells its
+// prediction which inputs the server has really applied.
+void NetServer::applyInputs() {
+    for (std::size_t id = 0; id < clients.size(); ++id) {
+        Client& client = clients[id];
+        if (!client.connected || client.newestInputSeq == NET_NO_TICK) continue;
+
+        const std::uint32_t backlog = client.newestInputSeq + 1 - client.nextInputSeq;
+        if (backlog > MAX_INPUT_BACKLOG) {
+            const std::uint32_t resumeSeq = client.newestInputSeq + 1 - INPUT_BACKLOG_TARGET;
+            const std::uint32_t skipFrom = backlog > INPUT_BUFFER ? resumeSeq - (INPUT_BUFFER - INPUT_BACKLOG_TARGET) : client.nextInputSeq;
+            for (std::uint32_t seq = skipFrom; seq < resumeSeq; ++seq) {
+                if (client.inputSeqs[seq % INPUT_BUFFER] == seq && client.inputs[seq % INPUT_BUFFER].toggleAttack) {
+                    client.toggleCarried = !client.toggleCarried;
+                }
+            }
+            client.nextInputSeq = resumeSeq;
+        }
+
+        const std::size_t slot = client.nextInputSeq % INPUT_BUFFER;
+        if (client.inputSeqs[slot] != client.nextInputSeq) continue; // Not here yet
+
+        TickInput input = client.inputs[slot];
+        if (client.toggleCarried) {
+            input.toggleAttack = !input.toggleAttack;
+            client.toggleCarried = false;
+        }
+        match.setInput(id, input);
+        client.lastAppliedSeq = client.nextInputSeq++;
+    }
+}
+
+void NetServer::dropSilentClients() {
+    const std::uint64_t timeoutTicks = static_cast<std::uint64_t>(CLIENT_TIMEOUT_S * options.tickRate);
+    for (std::size_t id = 0; id < clients.size(); ++id) {
+        Client& client = clients[id];
+        if (client.connected && match.getTickCount() - client.lastHeardTick > timeoutTicks) {
+            client.connected = false;
+            match.removeShip(id);
+        }
+    }
+}
+
+void NetServer::sendSnapshots() {
+    const NetWorldState& current = history[match.getTickCount() % NET_SNAPSHOT_HISTORY];
+    deltaCacheUsed = 0;
+
+    for (Client& client : clients) {
+        if (!client.connected) continue;
+
+        // The ack is only a usable baseline while we still hold that state
+        std::uint32_t baselineTick = client.ackedTick;
+        if (baselineTick != NET_NO_TICK) {
+            const std::uint32_t age = current.tick - baselineTick;
+            if (age == 0 || age >= NET_SNAPSHOT_HISTORY || history[baselineTick % NET_SNAPSHOT_HISTORY].tick != baselineTick) {
+                baselineTick = NET_NO_TICK;
+            }
+        }
+        const std::vector<std::uint8_t>& delta = deltaFor(baselineTick);
+
+        const std::size_t fragments = std::max<std::size_t>(
+            1, (delta.size() + NET_SNAPSHOT_FRAGMENT_BYTES - 1) / NET_SNAPSHOT_FRAGMENT_BYTES);
+        if (fragments > NET_MAX_SNAPSHOT_FRAGMENTS) {
+            // Tell the client rather than leave it waiting on a baseline that never comes
+            ++stats.oversizedSnapshots;
+            packet.clear();
+            NetWriter out(packet);
+            out.header(NetMessage::Reject);
+            out.u8(static_cast<std::uint8_t>(NetRejectReason::SnapshotTooLarge));
+            send(packet, client.address, client.port);
+            continue;
+        }
+        for (std::size_t fragment = 0; fragment < fragments; ++fragment) {
+            const std::size_t begin = fragment * NET_SNAPSHOT_FRAGMENT_BYTES;
+            const std::size_t end = std::min(delta.size(), begin + NET_SNAPSHOT_FRAGMENT_BYTES);
+            packet.clear();
+            NetWriter out(packet);
+            out.header(NetMessage::Snapshot);
+            out.u32(current.tick);
+            out.u32(baselineTick);
+            out.u32(client.lastAppliedSeq);
+            out.u16(lastTickUs);
+            out.u8(static_cast<std::uint8_t>(fragment));
+            out.u8(static_cast<std::uint8_t>(fragments));
+            out.bytes(delta.data() + begin, end - begin);
+            send(packet, client.address, client.port);
+        }
+        ++stats.snapshotsSent;
+        if (fragments > 1) ++stats.fragmentedSnapshots;
+        if (baselineTick == NET_NO_TICK) ++stats.fullSnapshotsSent;
+    }
+}
+
+const std::vector<std::uint8_t>& NetServer::deltaFor(std::uint32_t baselineTick) {
+    for (std::size_t i = 0; i < deltaCacheUsed; ++i) {
+        if (deltaCache[i].baselineTick == baselineTick) return deltaCache[i].bytes;
+    }
+    if (deltaCacheUsed == deltaCache.size()) {
+        deltaCache.emplace_back();
+    }
+    EncodedDelta& encoded = deltaCache[deltaCacheUsed++];
+    encoded.baselineTick = baselineTick;
+    encoded.bytes.clear();
+    NetWriter out(encoded.bytes);
+    const NetWorldState* baseline = baselineTick != NET_NO_TICK ? &history[baselineTick % NET_SNAPSHOT_HISTORY] : nullptr;
+    encodeWorldDelta(history[match.getTickCount() % NET_SNAPSHOT_HISTORY], baseline, out);
+    ++stats.deltasEncoded;
+    return encoded.bytes;
+}
+
+void NetServer::send(const std::vector<std::uint8_t>& data, const sf::IpAddress& address, unsigned short port) {
+    if (socket.send(data.data(), data.size(), address, port) == sf::Socket::Done) {
+        stats.bytesSent += data.size();
+    }
+}
+
+void NetServer::setJobSystem(JobSystem* jobs) {
+    match.setJobSystem(jobs);
+}
+
+NetServerStats NetServer::getStats() const {
+    NetServerStats result = stats;
+    result.clients = match.getShipCount();
+    std::vector<float> times(tickHistoryMs.begin(), tickHistoryMs.begin() + tickHistoryCount);
+    if (!times.empty()) {
+        result.tickMaxMs = *std::max_element(times.begin(), times.end());
+        result.tickP50Ms = percentile(times, 0.5f);
+        result.tickP99Ms = percentile(times, 0.99f);
+    }
+    return result;
+}
+
+const Match& NetServer::getMatch() const {
+    return match;
+}
@@ -0,0 +1,154 @@
+#include "ParticleEffects.hpp"
+
+#include <cmath>
+
+namespace {
+    // Pools
+    constexpr std::size_t ADDITIVE_CAPACITY = 1u << 19;
+    constexpr std::size_t ALPHA_CAPACITY = 1u << 16;
+    constexpr float ADDITIVE_DRAG = 0.9f; // Velocity lost per second
+    constexpr float ALPHA_DRAG = 0.6f;
+    constexpr std::uint32_t SEED = 0x9A271C1Eu;
+
+    // Ship shape, matching WorldRenderer's triangle
+    constexpr float SHIP_NOSE_OFFSET = 20.f;
+    constexpr float SHIP_TAIL_OFFSET = 15.f;
+    constexpr float SHIP_TAIL_HALF_WIDTH = 8.f;
+
+    // Engine plume
+    constexpr float THRUST_FLAMES_PER_S = 2400.f;
+    constexpr int THRUST_SMOKE_EVERY = 8; // One smoke puff per this many flames
+    constexpr float FLAME_SPREAD_DEG = 12.f;
+    constexpr float FLAME_MIN_SPEED = 120.f;
+    constexpr float FLAME_MAX_SPEED = 220.f;
+    constexpr float FLAME_MIN_LIFE_S = 0.25f;
+    constexpr float FLAME_MAX_LIFE_S = 0.5f;
+    constexpr float SMOKE_SPREAD_DEG = 25.f;
+    constexpr float SMOKE_MIN_SPEED = 40.f;
+    constexpr float SMOKE_MAX_SPEED = 80.f;
+    constexpr float SMOKE_MIN_LIFE_S = 0.8f;
+    constexpr float SMOKE_MAX_LIFE_S = 1.4f;
+    constexpr std::uint32_t FLAME_COLOR = 0xFFA030FF;
+    constexpr std::uint32_t SMOKE_COLOR = 0x70707090;
+
+    // Muzzle flash
+    constexpr int MUZZLE_SPARKS_PER_SHOT = 14;
+    constexpr float MUZZLE_SPREAD_DEG = 20.f;
+    constexpr float MUZZLE_MIN_SPEED = 150.f;
+    constexpr float MUZZLE_MAX_SPEED = 350.f;
+    constexpr float MUZZLE_MIN_LIFE_S = 0.08f;
+    constexpr float MUZZLE_MAX_LIFE_S = 0.18f;
+    constexpr std::uint32_t MUZZLE_COLOR = 0xFFF0A0FF;
+
+    // Impacts
+    constexpr int IMPACT_SPARKS = 24;
+    constexpr int IMPACT_DUST = 8;
+    constexpr float IMPACT_SPARK_MIN_SPEED = 60.f;
+    constexpr float IMPACT_SPARK_MAX_SPEED = 260.f;
+    constexpr float IMPACT_SPARK_MIN_LIFE_S = 0.2f;
+    constexpr float IMPACT_SPARK_MAX_LIFE_S = 0.5f;
+    constexpr float IMPACT_DUST_MIN_SPEED = 10.f;
+    constexpr float IMPACT_DUST_MAX_SPEED = 40.f;
+    constexpr float IMPACT_DUST_MIN_LIFE_S = 0.6f;
+    constexpr float IMPACT_DUST_MAX_LIFE_S = 1.2f;
+    constexpr std::uint32_t SPARK_COLOR = 0xFFFFFFFF;
+    constexpr std::uint32_t DUST_COLOR = 0x8C8C8CC0;
+
+    constexpr float FULL_TURN_DEG = 360.f;
+    constexpr float PI = 3.14159265f;
+
+    // Unit vector for a heading in degrees, 0 pointing up
+    sf::Vector2f headingVector(float degrees) {
+        const float radians = degrees * PI / 180.f;
+        return sf::Vector2f(std::sin(radians), -std::cos(radians));
+    }
+}
+
+ParticleEffects::ParticleEffects()
+    : additive(ADDITIVE_CAPACITY),
+      alphaBlended(ALPHA_CAPACITY),
+      seed(SEED),
+      thrustCarry(0.f)
+{
+    additive.setDrag(ADDITIVE_DRAG);
+    alphaBlended.setDrag(ALPHA_DRAG);
+}
+
+void ParticleEffects::emitThrust(const sf::Vector2f& shipPosition, float shipRotation, float shipScale, float deltaTime) {
+    const sf::Vector2f heading = headingVector(shipRotation);
+    const sf::Vector2f across(-heading.y, heading.x);
+    const sf::Vector2f tail = shipPosition - heading * (SHIP_TAIL_OFFSET * shipScale);
+    const float exhaust = shipRotation + FULL_TURN_DEG / 2.f;
+
+    thrustCarry += THRUST_FLAMES_PER_S * deltaTime;
+    const int flames = static_cast<int>(thrustCarry);
+    thrustCarry -= static_cast<float>(flames);
+    for (int i = 0; i < flames; ++i) {
+        const sf::Vector2f origin = tail + across * (random(-1.f, 1.f) * SHIP_TAIL_HALF_WIDTH * shipScale);
+        additive.spawn(origin, randomVelocity(exhaust, FLAME_SPREAD_DEG, FLAME_MIN_SPEED, FLAME_MAX_SPEED),
+                       random(FLAME_MIN_LIFE_S, FLAME_MAX_LIFE_S), FLAME_COLOR);
+        if (i % THRUST_SMOKE_EVERY == 0) {
+            alphaBlended.spawn(origin, randomVelocity(exhaust, SMOKE_SPREAD_DEG, SMOKE_MIN_SPEED, SMOKE_MAX_SPEED),
+                               random(SMOKE_MIN_LIFE_S, SMOKE_MAX_LIFE_S), SMOKE_COLOR);
+        }
+    }
+}
+
+void ParticleEffects::emitMuzzleFlash(const sf::Vector2f& shipPosition, float shipRotation, float shipScale, std::uint32_t shots) {
+    const sf::Vector2f nose = shipPosition + headingVector(shipRotation) * (SHIP_NOSE_OFFSET * shipScale);
+    for (std::uint32_t shot = 0; shot < shots; ++shot) {
+        for (int i = 0; i < MUZZLE_SPARKS_PER_SHOT; ++i) {
+            additive.spawn(nose, randomVelocity(shipRotation, MUZZLE_SPREAD_DEG, MUZZLE_MIN_SPEED, MUZZLE_MAX_SPEED),
+                           random(MUZZLE_MIN_LIFE_S, MUZZLE_MAX_LIFE_S), MUZZLE_COLOR);
+        }
+    }
+}
+
+void ParticleEffects::emitImpact(const sf::Vector2f& position) {
+    const float spread = FULL_TURN_DEG / 2.f; // Every direction
+    for (int i = 0; i < IMPACT_SPARKS; ++i) {
+        additive.spawn(position, randomVelocity(0.f, spread, IMPACT_SPARK_MIN_SPEED, IMPACT_SPARK_MAX_SPEED),
+                       random(IMPACT_SPARK_MIN_LIFE_S, IMPACT_SPARK_MAX_LIFE_S), SPARK_COLOR);
+    }
+    for (int i = 0; i < IMPACT_DUST; ++i) {
+        alphaBlended.spawn(position, randomVelocity(0.f, spread, IMPACT_DUST_MIN_SPEED, IMPACT_DUST_MAX_SPEED),
+                           random(IMPACT_DUST_MIN_LIFE_S, IMPACT_DUST_MAX_LIFE_S), DUST_COLOR);
+    }
+}
+
+void ParticleEffects::update(float deltaTime) {
+    additive.update(deltaTime);
+    alphaBlended.update(deltaTime);
+}
+
+void ParticleEffects::clear() {
+    additive.clear();
+    alphaBlended.clear();
+    thrustCarry = 0.f;
+}
+
+const ParticleSystem& ParticleEffects::getAdditive() const {
+    return additive;
+}
+
+const ParticleSystem& ParticleEffects::getAlphaBlended() const {
+    return alphaBlended;
+}
+
+std::size_t ParticleEffects::size() const {
+    return additive.size() + alphaBlended.size();
+}
+
+// Fixed-seed LCG; effects don't need to repeat, but it's cheap and never locks
+float ParticleEffects::random() {
+    seed = seed * 1664525u + 1013904223u;
+    return static_cast<float>(seed >> 8) / static_cast<float>(1u << 24);
+}
+
+float ParticleEffects::random(float low, float high) {
+    return low + random() * (high - low);
+}
+
+sf::Vector2f ParticleEffects::randomVelocity(float headingDegrees, float spreadDegrees, float minSpeed, float maxSpeed) {
+    return headingVector(headingDegrees + random(-spreadDegrees, spreadDegrees)) * random(minSpeed, maxSpeed);
+}
@@ -0,0 +1,30 @@
+#include "ParticleRenderer.hpp"
+#include "ParticleEffects.hpp"
+#include "RenderQueue.hpp"
+
+void ParticleRenderer::draw(RenderQueue& queue, const ParticleEffects& effects, const sf::Vector2f& viewMin,
+                            const sf::Vector2f& viewMax) {
+    // Alpha blending sorts first, so smoke stays under the glow
+    drawPool(queue, effects.getAlphaBlended(), RenderBlend::Alpha, viewMin, viewMax);
+    drawPool(queue, effects.getAdditive(), RenderBlend::Add, viewMin, viewMax);
+}
+
+void ParticleRenderer::drawPool(RenderQueue& queue, const ParticleSystem& particles, RenderBlend blend,
+                                const sf::Vector2f& viewMin, const sf::Vector2f& viewMax) {
+    const std::size_t count = particles.size();
+    if (count == 0) return;
+    const float* x = particles.positionsX();
+    const float* y = particles.positionsY();
+    const float* fades = particles.fades();
+    const std::uint32_t* colors = particles.colors();
+
+    sf::Vertex* vertices = queue.push(RenderLayer::Effects, sf::Points, nullptr, blend, count);
+    std::size_t visible = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (x[i] < viewMin.x || x[i] > viewMax.x || y[i] < viewMin.y || y[i] > viewMax.y) continue;
+        sf::Color color(colors[i]);
+        color.a = static_cast<sf::Uint8>(color.a * fades[i]);
+        vertices[visible++] = sf::Vertex(sf::Vector2f(x[i], y[i]), color);
+    }
+    queue.shrinkLast(visible);
+}
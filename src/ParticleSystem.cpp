@@ -0,0 +1,191 @@
+#include "ParticleSystem.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+// Same instruction set split as the projectile kernels: vector paths on
+// x86-64 only, picked at runtime from detectSimdLevel()
+#if defined(__x86_64__) || defined(_M_X64)
+#define PARTICLE_KERNELS_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#define KERNEL_TARGET(isa)
+#else
+#define KERNEL_TARGET(isa) __attribute__((target(isa)))
+#endif
+#else
+#define PARTICLE_KERNELS_X86 0
+#endif
+
+namespace {
+    constexpr float MIN_LIFETIME_S = 0.001f;
+
+    struct ParticleArrays {
+        float* posX;
+        float* posY;
+        float* velX;
+        float* velY;
+        float* age;
+        const float* inverseLifetime;
+        float* fade;
+    };
+
+    // `keep` is the fraction of velocity that survives this step's drag
+    using UpdateFn = void (*)(const ParticleArrays&, std::size_t, float, float);
+
+    void updateScalarRange(const ParticleArrays& a, std::size_t begin, std::size_t count, float deltaTime, float keep) {
+        for (std::size_t i = begin; i < count; ++i) {
+            a.velX[i] *= keep;
+            a.velY[i] *= keep;
+            a.posX[i] += a.velX[i] * deltaTime;
+            a.posY[i] += a.velY[i] * deltaTime;
+            a.age[i] += deltaTime;
+            a.fade[i] = std::max(0.f, 1.f - a.age[i] * a.inverseLifetime[i]);
+        }
+    }
+
+    void updateScalar(const ParticleArrays& a, std::size_t count, float deltaTime, float keep) {
+        updateScalarRange(a, 0, count, deltaTime, keep);
+    }
+
+#if PARTICLE_KERNELS_X86
+    void updateSse2(const ParticleArrays& a, std::size_t count, float deltaTime, float keep) {
+        const __m128 dt = _mm_set1_ps(deltaTime);
+        const __m128 k = _mm_set1_ps(keep);
+        const __m128 one = _mm_set1_ps(1.f);
+        const __m128 zero = _mm_setzero_ps();
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            const __m128 vx = _mm_mul_ps(_mm_loadu_ps(a.velX + i), k);
+            const __m128 vy = _mm_mul_ps(_mm_loadu_ps(a.velY + i), k);
+            const __m128 age = _mm_add_ps(_mm_loadu_ps(a.age + i), dt);
+            const __m128 fade = _mm_max_ps(zero, _mm_sub_ps(one, _mm_mul_ps(age, _mm_loadu_ps(a.inverseLifetime + i))));
+            _mm_storeu_ps(a.velX + i, vx);
+            _mm_storeu_ps(a.velY + i, vy);
+            _mm_storeu_ps(a.posX + i, _mm_add_ps(_mm_loadu_ps(a.posX + i), _mm_mul_ps(vx, dt)));
+            _mm_storeu_ps(a.posY + i, _mm_add_ps(_mm_loadu_ps(a.posY + i), _mm_mul_ps(vy, dt)));
+            _mm_storeu_ps(a.age + i, age);
+            _mm_storeu_ps(a.fade + i, fade);
+        }
+        updateScalarRange(a, i, count, deltaTime, keep);
+    }
+
+    KERNEL_TARGET("avx2")
+    void updateAvx2(const ParticleArrays& a, std::size_t count, float deltaTime, float keep) {
+        const __m256 dt = _mm256_set1_ps(deltaTime);
+        const __m256 k = _mm256_set1_ps(keep);
+        const __m256 one = _mm256_set1_ps(1.f);
+        const __m256 zero = _mm256_setzero_ps();
+        std::size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            const __m256 vx = _mm256_mul_ps(_mm256_loadu_ps(a.velX + i), k);
+            const __m256 vy = _mm256_mul_ps(_mm256_loadu_ps(a.velY + i), k);
+            const __m256 age = _mm256_add_ps(_mm256_loadu_ps(a.age + i), dt);
+            const __m256 fade = _mm256_max_ps(zero, _mm256_sub_ps(one, _mm256_mul_ps(age, _mm256_loadu_ps(a.inverseLifetime + i))));
+            _mm256_storeu_ps(a.velX + i, vx);
+            _mm256_storeu_ps(a.velY + i, vy);
+            _mm256_storeu_ps(a.posX + i, _mm256_add_ps(_mm256_loadu_ps(a.posX + i), _mm256_mul_ps(vx, dt)));
+            _mm256_storeu_ps(a.posY + i, _mm256_add_ps(_mm256_loadu_ps(a.posY + i), _mm256_mul_ps(vy, dt)));
+            _mm256_storeu_ps(a.age + i, age);
+            _mm256_storeu_ps(a.fade + i, fade);
+        }
+        _mm256_zeroupper();
+        updateScalarRange(a, i, count, deltaTime, keep);
+    }
+#endif
+
+    UpdateFn kernelFor(SimdLevel level) {
+        switch (level) {
+#if PARTICLE_KERNELS_X86
+            case SimdLevel::AVX512: // Bandwidth bound already; wider lanes don't help
+            case SimdLevel::AVX2: return updateAvx2;
+            case SimdLevel::SSE2: return updateSse2;
+#endif
+            default: return updateScalar;
+        }
+    }
+}
+
+ParticleSystem::ParticleSystem(std::size_t capacity)
+    : count(0),
+      refusedCount(0),
+      drag(0.f),
+      posX(capacity),
+      posY(capacity),
+      velX(capacity),
+      velY(capacity),
+      age(capacity),
+      inverseLifetime(capacity),
+      fade(capacity),
+      color(capacity) {}
+
+void ParticleSystem::setDrag(float newDrag) {
+    drag = std::min(std::max(newDrag, 0.f), 1.f);
+}
+
+bool ParticleSystem::spawn(const sf::Vector2f& position, const sf::Vector2f& velocity, float lifetime, std::uint32_t c) {
+    if (count == capacity()) {
+        ++refusedCount;
+        return false;
+    }
+    const std::size_t i = count++;
+    posX[i] = position.x;
+    posY[i] = position.y;
+    velX[i] = velocity.x;
+    velY[i] = velocity.y;
+    age[i] = 0.f;
+    inverseLifetime[i] = 1.f / std::max(lifetime, MIN_LIFETIME_S);
+    fade[i] = 1.f;
+    color[i] = c;
+    return true;
+}
+
+void ParticleSystem::clear() {
+    count = 0;
+}
+
+void ParticleSystem::update(float deltaTime) {
+    static const UpdateFn kernel = kernelFor(detectSimdLevel());
+    const ParticleArrays arrays{posX.data(), posY.data(), velX.data(), velY.data(), age.data(), inverseLifetime.data(), fade.data()};
+    kernel(arrays, count, deltaTime, std::pow(1.f - drag, deltaTime));
+    removeDead();
+}
+
+void ParticleSystem::update(SimdLevel level, float deltaTime) {
+    if (level > detectSimdLevel()) level = detectSimdLevel();
+    const ParticleArrays arrays{posX.data(), posY.data(), velX.data(), velY.data(), age.data(), inverseLifetime.data(), fade.data()};
+    kernelFor(level)(arrays, count, deltaTime, std::pow(1.f - drag, deltaTime));
+    removeDead();
+}
+
+// Fills each hole with the last live particle; only a few die per frame
+void ParticleSystem::removeDead() {
+    std::size_t i = 0;
+    while (i < count) {
+        if (fade[i] > 0.f) {
+            ++i;
+            continue;
+        }
+        const std::size_t last = --count;
+        posX[i] = posX[last];
+        posY[i] = posY[last];
+        velX[i] = velX[last];
+        velY[i] = velY[last];
+        age[i] = age[last];
+        inverseLifetime[i] = inverseLifetime[last];
+        fade[i] = fade[last];
+        color[i] = color[last];
+    }
+}
+
+std::size_t ParticleSystem::size() const {
+    return count;
+}
+
+std::size_t ParticleSystem::capacity() const {
+    return posX.size();
+}
+
+std::size_t ParticleSystem::getRefusedCount() const {
+    return refusedCount;
+}
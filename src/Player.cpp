@@ -8,42 +8,47 @@ namespace {
     constexpr float PLAYER_ACCELERATION = 600.f;
     constexpr float PLAYER_FRICTION = 800.f;
     constexpr float PLAYER_MAX_SPEED = 600.f;
-    const sf::Color PLAYER_COLOR = sf::Color::Green;
     constexpr float INITIAL_ROTATION_DEG = 0.f;
-
-    // Shape Definition (Triangle pointing up)
-    constexpr float PLAYER_SHAPE_POINT_0_Y = -20.f;
-    constexpr float PLAYER_SHAPE_POINT_1_X = -15.f;
-    constexpr float PLAYER_SHAPE_POINT_1_Y = 15.f;
-    constexpr float PLAYER_SHAPE_POINT_2_X = 15.f;
-    constexpr float PLAYER_SHAPE_POINT_2_Y = 15.f;
+    constexpr float INITIAL_SCALE = 1.f;
 
     // Movement Calculation
     constexpr float ANGLE_CORRECTION_DEG = 90.f;
     constexpr float PI = 3.14159265f;
+
+    // Interpolation
+    constexpr float HALF_TURN_DEG = 180.f;
+    constexpr float FULL_TURN_DEG = 360.f;
 }
 
-// Triangle shape, pointing up
-Player::Player(float x, float y) : speed(200.0f), rotationSpeed(180.0f), velocity(0.f, 0.f), acceleration(PLAYER_ACCELERATION), friction(PLAYER_FRICTION), maxSpeed(PLAYER_MAX_SPEED) {
-    shape.setPointCount(3);
-    shape.setPoint(0, sf::Vector2f(0.f, PLAYER_SHAPE_POINT_0_Y));
-    shape.setPoint(1, sf::Vector2f(PLAYER_SHAPE_POINT_1_X, PLAYER_SHAPE_POINT_1_Y));
-    shape.setPoint(2, sf::Vector2f(PLAYER_SHAPE_POINT_2_X, PLAYER_SHAPE_POINT_2_Y));
-    shape.setFillColor(PLAYER_COLOR);
-    shape.setPosition(x, y);
-    shape.setRotation(INITIAL_ROTATION_DEG);
+Player::Player(float x, float y) : position(x, y), rotation(INITIAL_ROTATION_DEG), scale(INITIAL_SCALE), speed(200.0f), rotationSpeed(180.0f), velocity(0.f, 0.f), acceleration(PLAYER_ACCELERATION), friction(PLAYER_FRICTION), maxSpeed(PLAYER_MAX_SPEED) {
+    storePreviousState();
 }
 
 void Player::update(float deltaTime) {
     // No automatic update for now
 }
 
-void Player::draw(sf::RenderWindow& window) {
-    window.draw(shape);
+void Player::storePreviousState() {
+    previousPosition = position;
+    previousRotation = rotation;
+}
+
+sf::Vector2f Player::getInterpolatedPosition(float alpha) const {
+    return previousPosition + (position - previousPosition) * alpha;
+}
+
+float Player::getInterpolatedRotation(float alpha) const {
+    // Turn the short way round when the angle wraps past 0/360
+    float rotationDelta = rotation - previousRotation;
+    if (rotationDelta > HALF_TURN_DEG) rotationDelta -= FULL_TURN_DEG;
+    if (rotationDelta < -HALF_TURN_DEG) rotationDelta += FULL_TURN_DEG;
+    return previousRotation + rotationDelta * alpha;
 }
 
 void Player::rotate(float angle) {
-    shape.rotate(angle);
+    // Keep the angle in [0, 360), like sf::Transformable does
+    rotation = std::fmod(rotation + angle, FULL_TURN_DEG);
+    if (rotation < 0.f) rotation += FULL_TURN_DEG;
 }
 
 void Player::updateMovement(float deltaTime, float force) {
@@ -64,7 +69,7 @@ void Player::updateMovement(float deltaTime, float force) {
         velocity = velocity / speed * maxSpeed;
     }
     // Update position using velocity
-    shape.setPosition(shape.getPosition() + velocity * deltaTime);
+    position += velocity * deltaTime;
 }
 
 void Player::applyMovementForce(float force, float deltaTime, float angleDegrees) {
@@ -83,11 +88,15 @@ void Player::handleRotation(float rotationSpeed, float deltaTime) {
 }
 
 sf::Vector2f Player::getPosition() const {
-    return shape.getPosition();
+    return position;
 }
 
 float Player::getRotation() const {
-    return shape.getRotation();
+    return rotation;
+}
+
+sf::Vector2f Player::getVelocity() const {
+    return velocity;
 }
 
 // --- Getters for Debug Controls ---
@@ -104,8 +113,7 @@ float Player::getMaxSpeed() const {
 }
 
 float Player::getScale() const {
-    // Assuming uniform scaling; return x-scale
-    return shape.getScale().x;
+    return scale;
 }
 
 // --- Setters for Debug Controls ---
@@ -121,10 +129,25 @@ void Player::setMaxSpeed(float speed) {
     maxSpeed = speed > 0 ? speed : 0; // Ensure non-negative
 }
 
-void Player::setScale(float scale) {
-    float clampedScale = scale > 0.1f ? scale : 0.1f; // Prevent zero or negative scale
-    shape.setScale(clampedScale, clampedScale);
-    // Adjust origin if necessary after scaling, though center origin is usually fine
-    // sf::FloatRect bounds = shape.getLocalBounds();
-    // shape.setOrigin(bounds.left + bounds.width / 2.f, bounds.top + bounds.height / 2.f);
+void Player::setScale(float newScale) {
+    scale = newScale > 0.1f ? newScale : 0.1f; // Prevent zero or negative scale
+}
+
+PlayerState Player::getState() const {
+    return PlayerState{position, rotation, scale, speed, rotationSpeed, acceleration, maxSpeed, friction,
+                       velocity, previousPosition, previousRotation};
+}
+
+void Player::setState(const PlayerState& state) {
+    position = state.position;
+    rotation = state.rotation;
+    scale = state.scale;
+    speed = state.speed;
+    rotationSpeed = state.rotationSpeed;
+    acceleration = state.acceleration;
+    maxSpeed = state.maxSpeed;
+    friction = state.friction;
+    velocity = state.velocity;
+    previousPosition = state.previousPosition;
+    previousRotation = state.previousRotation;
 }
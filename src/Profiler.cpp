@@ -0,0 +1,96 @@
+#include "Profiler.hpp"
+
+#include <algorithm>
+
+namespace {
+    constexpr float NS_PER_MS = 1e6f;
+    constexpr float P99_FRACTION = 0.99f;
+}
+
+Profiler& Profiler::instance() {
+    static Profiler profiler;
+    return profiler;
+}
+
+Profiler::Profiler()
+    : phaseNames{},
+      phaseDepths{},
+      phaseCount(0),
+      currentDepth(0),
+      currentFrameNs{},
+      phaseHistoryMs{},
+      frameHistoryMs{},
+      historyHead(0),
+      historyCount(0),
+      frameStart(std::chrono::steady_clock::now()) {}
+
+std::size_t Profiler::beginScope(const char* name) {
+    const int depth = currentDepth++;
+
+    // Phase names are string literals, so pointer comparison is enough
+    for (std::size_t i = 0; i < phaseCount; ++i) {
+        if (phaseNames[i] == name) return i;
+    }
+    if (phaseCount == MAX_PHASES) return MAX_PHASES; // Table full: drop the sample
+    phaseNames[phaseCount] = name;
+    phaseDepths[phaseCount] = depth;
+    return phaseCount++;
+}
+
+void Profiler::endScope(std::size_t phase, std::chrono::steady_clock::duration elapsed) {
+    --currentDepth;
+    if (phase < MAX_PHASES) {
+        currentFrameNs[phase] += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    }
+}
+
+void Profiler::nextFrame() {
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    const std::int64_t frameNs = std::chrono::duration_cast<std::chrono::nanoseconds>(now - frameStart).count();
+    frameStart = now;
+
+    frameHistoryMs[historyHead] = static_cast<float>(frameNs) / NS_PER_MS;
+    for (std::size_t i = 0; i < MAX_PHASES; ++i) {
+        phaseHistoryMs[historyHead][i] = static_cast<float>(currentFrameNs[i]) / NS_PER_MS;
+        currentFrameNs[i] = 0;
+    }
+    historyHead = (historyHead + 1) % HISTORY_FRAMES;
+    historyCount = std::min(historyCount + 1, HISTORY_FRAMES);
+}
+
+std::size_t Profiler::getPhaseStats(PhaseStats* out, std::size_t maxPhases) const {
+    const std::size_t count = std::min(phaseCount, maxPhases);
+    const std::size_t newest = (historyHead + HISTORY_FRAMES - 1) % HISTORY_FRAMES;
+    std::array<float, HISTORY_FRAMES> samples;
+
+    for (std::size_t phase = 0; phase < count; ++phase) {
+        PhaseStats& stats = out[phase];
+        stats.name = phaseNames[phase];
+        stats.depth = phaseDepths[phase];
+        stats.lastMs = stats.minMs = stats.avgMs = stats.p99Ms = 0.f;
+        if (historyCount == 0) continue;
+
+        float sum = 0.f;
+        for (std::size_t i = 0; i < historyCount; ++i) {
+            samples[i] = phaseHistoryMs[i][phase];
+            sum += samples[i];
+        }
+        stats.lastMs = phaseHistoryMs[newest][phase];
+        stats.avgMs = sum / static_cast<float>(historyCount);
+        stats.minMs = *std::min_element(samples.begin(), samples.begin() + historyCount);
+
+        const std::size_t p99Index = static_cast<std::size_t>(P99_FRACTION * static_cast<float>(historyCount - 1));
+        std::nth_element(samples.begin(), samples.begin() + p99Index, samples.begin() + historyCount);
+        stats.p99Ms = samples[p99Index];
+    }
+    return count;
+}
+
+std::size_t Profiler::getFrameHistory(float* out, std::size_t maxFrames) const {
+    const std::size_t count = std::min(historyCount, maxFrames);
+    const std::size_t oldest = (historyHead + HISTORY_FRAMES - count) % HISTORY_FRAMES;
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = frameHistoryMs[(oldest + i) % HISTORY_FRAMES];
+    }
+    return count;
+}
@@ -0,0 +1,115 @@
+#include "ProfilerOverlay.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace {
+    // Layout
+    constexpr float MARGIN_X = 10.f;
+    constexpr float MARGIN_Y = 10.f;
+    constexpr float PANEL_WIDTH = 300.f;
+    constexpr unsigned int FONT_SIZE = 14;
+    constexpr float LINE_HEIGHT = 17.f;
+    constexpr float GRAPH_HEIGHT = 60.f;
+    constexpr float GRAPH_SPACING_Y = 8.f;
+    constexpr float INDENT_CHARS = 2.f;
+    const sf::Color TEXT_COLOR = sf::Color::White;
+
+    // Graph scale: the full height is two 60 Hz frames
+    constexpr float GRAPH_MAX_MS = 1000.f / 30.f;
+    constexpr float TARGET_FRAME_MS = 1000.f / 60.f;
+    const sf::Color GRAPH_OK_COLOR = sf::Color(80, 200, 80);
+    const sf::Color GRAPH_SLOW_COLOR = sf::Color(230, 200, 60);
+    const sf::Color GRAPH_MISSED_COLOR = sf::Color(230, 70, 70);
+    const sf::Color GRAPH_TARGET_LINE_COLOR = sf::Color(255, 255, 255, 120);
+}
+
+ProfilerOverlay::ProfilerOverlay()
+    : graph(sf::Quads),
+      phaseStats{},
+      visible(false)
+{
+    text.setCharacterSize(FONT_SIZE);
+    text.setFillColor(TEXT_COLOR);
+    textBuffer.reserve(Profiler::MAX_PHASES * 64);
+    graph.resize(Profiler::HISTORY_FRAMES * 4 + 4); // Bars plus the target line
+    graph.clear();
+}
+
+void ProfilerOverlay::setFont(const sf::Font& font) {
+    text.setFont(font);
+}
+
+void ProfilerOverlay::toggle() {
+    visible = !visible;
+}
+
+bool ProfilerOverlay::isVisible() const {
+    return visible;
+}
+
+void ProfilerOverlay::capture(ProfilerCapture& out) {
+    out.visible = visible;
+    if (!visible) return;
+
+    std::size_t length = 0;
+    auto append = [&out, &length](const char* line) {
+        const int written = std::snprintf(out.text.data() + length, out.text.size() - length, "%s", line);
+        length = std::min(length + static_cast<std::size_t>(std::max(written, 0)), out.text.size() - 1);
+    };
+#if defined(GAME_ENABLE_PROFILER)
+    const std::size_t count = Profiler::instance().getPhaseStats(phaseStats.data(), phaseStats.size());
+    append("phase  last / min / avg / p99 ms\n");
+    char line[96];
+    for (std::size_t i = 0; i < count; ++i) {
+        const Profiler::PhaseStats& stats = phaseStats[i];
+        const int indent = static_cast<int>(stats.depth * INDENT_CHARS);
+        std::snprintf(line, sizeof(line), "%*s%s  %.2f / %.2f / %.2f / %.2f\n", indent, "", stats.name,
+                      stats.lastMs, stats.minMs, stats.avgMs, stats.p99Ms);
+        append(line);
+    }
+#else
+    append("Profiler compiled out of this build");
+#endif
+    out.text[length] = '\0';
+    out.frameCount = Profiler::instance().getFrameHistory(out.frameTimes.data(), out.frameTimes.size());
+}
+
+void ProfilerOverlay::draw(sf::RenderWindow& window, RenderQueue& overlay, const ProfilerCapture& captured) {
+    if (!captured.visible) return;
+
+    const sf::Vector2f origin(window.getSize().x - PANEL_WIDTH - MARGIN_X, MARGIN_Y);
+    textBuffer.assign(captured.text.data());
+    text.setString(textBuffer);
+    text.setPosition(origin.x, origin.y + GRAPH_HEIGHT + GRAPH_SPACING_Y);
+    buildGraph(captured, origin);
+
+    overlay.push(RenderLayer::Overlay, graph);
+    window.draw(text);
+}
+
+void ProfilerOverlay::buildGraph(const ProfilerCapture& captured, const sf::Vector2f& origin) {
+    graph.clear();
+    const std::size_t count = captured.frameCount;
+    const float barWidth = PANEL_WIDTH / static_cast<float>(Profiler::HISTORY_FRAMES);
+    const float bottom = origin.y + GRAPH_HEIGHT;
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const float ms = captured.frameTimes[i];
+        const float height = std::min(ms / GRAPH_MAX_MS, 1.f) * GRAPH_HEIGHT;
+        const sf::Color color = ms <= TARGET_FRAME_MS ? GRAPH_OK_COLOR
+                              : ms <= GRAPH_MAX_MS ? GRAPH_SLOW_COLOR : GRAPH_MISSED_COLOR;
+        const float left = origin.x + static_cast<float>(i) * barWidth;
+        graph.append(sf::Vertex(sf::Vector2f(left, bottom - height), color));
+        graph.append(sf::Vertex(sf::Vector2f(left + barWidth, bottom - height), color));
+        graph.append(sf::Vertex(sf::Vector2f(left + barWidth, bottom), color));
+        graph.append(sf::Vertex(sf::Vector2f(left, bottom), color));
+    }
+
+    // One-pixel line at the 60 Hz budget
+    const float targetY = bottom - TARGET_FRAME_MS / GRAPH_MAX_MS * GRAPH_HEIGHT;
+    graph.append(sf::Vertex(sf::Vector2f(origin.x, targetY), GRAPH_TARGET_LINE_COLOR));
+    graph.append(sf::Vertex(sf::Vector2f(origin.x + PANEL_WIDTH, targetY), GRAPH_TARGET_LINE_COLOR));
+    graph.append(sf::Vertex(sf::Vector2f(origin.x + PANEL_WIDTH, targetY + 1.f), GRAPH_TARGET_LINE_COLOR));
+    graph.append(sf::Vertex(sf::Vector2f(origin.x, targetY + 1.f), GRAPH_TARGET_LINE_COLOR));
+}
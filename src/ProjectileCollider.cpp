@@ -0,0 +1,116 @@
+#include "ProjectileCollider.hpp"
+#include "ProjectileStore.hpp"
+#include "JobSystem.hpp"
+
+#include <algorithm>
+
+namespace {
+    constexpr std::size_t QUERY_JOB_GRAIN = 2048; // Projectiles per job; fixed so hit order never depends on thread count
+}
+
+ProjectileCollider::ProjectileCollider()
+    : jobSystem(nullptr), targetCount(0), candidateCount(0) {}
+
+void ProjectileCollider::setWorldSize(const sf::Vector2f& size) {
+    grid.setWorldSize(size);
+}
+
+SpatialGrid& ProjectileCollider::getGrid() {
+    return grid;
+}
+
+void ProjectileCollider::setJobSystem(JobSystem* jobs) {
+    jobSystem = jobs;
+}
+
+const std::vector<CollisionPair>& ProjectileCollider::detect(const ProjectileStore& projectiles, const CollisionBodies& targets) {
+    if (projectiles.empty()) return query(projectiles); // Nothing to test, so leave the grid alone
+    // Pad targets by the largest projectile so one cell lookup per projectile is enough
+    prepare(targets, maxRadius(projectiles));
+    return query(projectiles);
+}
+
+void ProjectileCollider::prepare(const CollisionBodies& targets, float padding) {
+    targetCount = targets.count;
+    if (targetCount > 0) grid.update(targets, padding);
+}
+
+const std::vector<CollisionPair>& ProjectileCollider::query(const ProjectileStore& projectiles) {
+    hits.clear();
+    hitProjectiles.clear();
+    candidateCount = 0;
+    if (targetCount == 0 || projectiles.empty()) return hits;
+
+    const std::size_t count = projectiles.size();
+    if (!jobSystem || count <= QUERY_JOB_GRAIN || jobSystem->getThreadCount() == 1) {
+        candidateCount = queryRange(projectiles, 0, count, hits);
+    } else {
+        const std::size_t chunkCount = (count + QUERY_JOB_GRAIN - 1) / QUERY_JOB_GRAIN;
+        if (chunkHits.size() < chunkCount) chunkHits.resize(chunkCount);
+        chunkCandidates.resize(chunkCount);
+        auto runChunk = [this, &projectiles](std::size_t begin, std::size_t end) {
+            std::vector<CollisionPair>& out = chunkHits[begin / QUERY_JOB_GRAIN];
+            out.clear();
+            chunkCandidates[begin / QUERY_JOB_GRAIN] = queryRange(projectiles, begin, end, out);
+        };
+        jobSystem->parallelFor(count, QUERY_JOB_GRAIN, runChunk);
+        for (std::size_t c = 0; c < chunkCount; ++c) {
+            hits.insert(hits.end(), chunkHits[c].begin(), chunkHits[c].end());
+            candidateCount += chunkCandidates[c];
+        }
+    }
+    for (const CollisionPair& hit : hits) {
+        hitProjectiles.push_back(hit.projectile);
+    }
+    return hits;
+}
+
+std::size_t ProjectileCollider::queryRange(const ProjectileStore& projectiles, std::size_t begin, std::size_t end,
+                                           std::vector<CollisionPair>& out) const {
+    const float* px = projectiles.positionsX();
+    const float* py = projectiles.positionsY();
+    const float* pr = projectiles.radii();
+    std::size_t candidates = 0;
+
+    // Broadphase and narrowphase fused, so candidate pairs are never stored
+    for (std::size_t i = begin; i < end; ++i) {
+        const std::int32_t cell = grid.cellAt(px[i], py[i]);
+        if (cell < 0) continue;
+        const GridEntry* first = grid.cellBegin(cell);
+        const GridEntry* last = grid.cellEnd(cell);
+        candidates += static_cast<std::size_t>(last - first);
+
+        // Entries are in target order, so the first overlap is the lowest index
+        for (const GridEntry* entry = first; entry != last; ++entry) {
+            const float dx = px[i] - entry->x;
+            const float dy = py[i] - entry->y;
+            const float reach = pr[i] + entry->radius;
+            if (dx * dx + dy * dy <= reach * reach) {
+                out.push_back(CollisionPair{static_cast<std::uint32_t>(i), entry->target});
+                break;
+            }
+        }
+    }
+    return candidates;
+}
+
+float ProjectileCollider::maxRadius(const ProjectileStore& projectiles) {
+    const float* radii = projectiles.radii();
+    float largest = 0.f;
+    for (std::size_t i = 0; i < projectiles.size(); ++i) {
+        largest = std::max(largest, radii[i]);
+    }
+    return largest;
+}
+
+const std::vector<CollisionPair>& ProjectileCollider::getHits() const {
+    return hits;
+}
+
+const std::vector<std::uint32_t>& ProjectileCollider::getHitProjectiles() const {
+    return hitProjectiles;
+}
+
+std::size_t ProjectileCollider::getCandidateCount() const {
+    return candidateCount;
+}
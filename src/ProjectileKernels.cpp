@@ -0,0 +1,343 @@
+#include "ProjectileKernels.hpp"
+#include "JobSystem.hpp"
+
+#include <algorithm>
+#include <vector>
+
+// Vector paths are only built on x86-64, where scalar float math is SSE as
+// well, so both sides round identically (32-bit x87 would not).
+#if defined(__x86_64__) || defined(_M_X64)
+#define PROJECTILE_KERNELS_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define KERNEL_TARGET(isa)
+#else
+#define KERNEL_TARGET(isa) __attribute__((target(isa)))
+#endif
+#else
+#define PROJECTILE_KERNELS_X86 0
+#endif
+
+namespace {
+    using KernelFn = std::size_t (*)(const ProjectileArrays&, std::size_t, float, float, float);
+
+    inline unsigned int countBits(unsigned int mask) {
+        unsigned int bits = 0;
+        for (; mask != 0; mask &= mask - 1) ++bits;
+        return bits;
+    }
+
+    inline bool isOutside(float x, float y, float maxX, float maxY) {
+        return x < 0 || x > maxX || y < 0 || y > maxY;
+    }
+
+    // Writes an already-integrated projectile from slot `from` into slot `to`.
+    // to <= from, and the old position is read before anything is written.
+    inline void keepProjectile(const ProjectileArrays& a, std::size_t to, std::size_t from, float x, float y) {
+        a.prevX[to] = a.posX[from];
+        a.prevY[to] = a.posY[from];
+        a.posX[to] = x;
+        a.posY[to] = y;
+        a.velX[to] = a.velX[from];
+        a.velY[to] = a.velY[from];
+        a.radius[to] = a.radius[from];
+        a.color[to] = a.color[from];
+        a.slot[to] = a.slot[from];
+    }
+
+    // Everything before `read` was either kept or retired, so the retired
+    // count is implied by the two cursors
+    inline void retireProjectile(const ProjectileArrays& a, std::size_t write, std::size_t read) {
+        a.retiredSlots[read - write] = a.slot[read];
+    }
+
+    // Processes [read, count) and returns the new write position. Also used for
+    // the tail the vector paths leave behind.
+    std::size_t integrateAndCullScalarRange(const ProjectileArrays& a, std::size_t read, std::size_t count,
+                                            std::size_t write, float deltaTime, float maxX, float maxY) {
+        for (; read < count; ++read) {
+            const float x = a.posX[read] + a.velX[read] * deltaTime;
+            const float y = a.posY[read] + a.velY[read] * deltaTime;
+            if (!isOutside(x, y, maxX, maxY)) {
+                keepProjectile(a, write++, read, x, y);
+            } else {
+                retireProjectile(a, write, read);
+            }
+        }
+        return write;
+    }
+
+    std::size_t integrateAndCullScalar(const ProjectileArrays& a, std::size_t count, float deltaTime, float maxX, float maxY) {
+        return integrateAndCullScalarRange(a, 0, count, 0, deltaTime, maxX, maxY);
+    }
+
+#if PROJECTILE_KERNELS_X86
+    // Lane-by-lane fallback for a vector block where not every projectile survives
+    inline std::size_t keepLanes(const ProjectileArrays& a, std::size_t write, std::size_t read,
+                                 const float* xs, const float* ys, unsigned int aliveMask, int lanes) {
+        for (int lane = 0; lane < lanes; ++lane) {
+            if (aliveMask & (1u << lane)) {
+                keepProjectile(a, write++, read + lane, xs[lane], ys[lane]);
+            } else {
+                retireProjectile(a, write, read + lane);
+            }
+        }
+        return write;
+    }
+
+    std::size_t integrateAndCullSse2(const ProjectileArrays& a, std::size_t count, float deltaTime, float maxX, float maxY) {
+        const __m128 dt = _mm_set1_ps(deltaTime);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 limitX = _mm_set1_ps(maxX);
+        const __m128 limitY = _mm_set1_ps(maxY);
+
+        std::size_t read = 0;
+        std::size_t write = 0;
+        for (; read + 4 <= count; read += 4) {
+            const __m128 x0 = _mm_loadu_ps(a.posX + read);
+            const __m128 y0 = _mm_loadu_ps(a.posY + read);
+            const __m128 x = _mm_add_ps(x0, _mm_mul_ps(_mm_loadu_ps(a.velX + read), dt));
+            const __m128 y = _mm_add_ps(y0, _mm_mul_ps(_mm_loadu_ps(a.velY + read), dt));
+            const __m128 outside = _mm_or_ps(_mm_or_ps(_mm_cmplt_ps(x, zero), _mm_cmpgt_ps(x, limitX)),
+                                              _mm_or_ps(_mm_cmplt_ps(y, zero), _mm_cmpgt_ps(y, limitY)));
+            const unsigned int alive = ~static_cast<unsigned int>(_mm_movemask_ps(outside)) & 0xFu;
+
+            if (alive == 0xFu) {
+                // Whole block survives: loads happen before stores, so overlap is safe
+                const __m128 vx = _mm_loadu_ps(a.velX + read);
+                const __m128 vy = _mm_loadu_ps(a.velY + read);
+                const __m128 r = _mm_loadu_ps(a.radius + read);
+                const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a.color + read));
+                const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a.slot + read));
+                _mm_storeu_ps(a.prevX + write, x0);
+                _mm_storeu_ps(a.prevY + write, y0);
+                _mm_storeu_ps(a.posX + write, x);
+                _mm_storeu_ps(a.posY + write, y);
+                _mm_storeu_ps(a.velX + write, vx);
+                _mm_storeu_ps(a.velY + write, vy);
+                _mm_storeu_ps(a.radius + write, r);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(a.color + write), c);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(a.slot + write), s);
+                write += 4;
+            } else {
+                alignas(16) float xs[4];
+                alignas(16) float ys[4];
+                _mm_store_ps(xs, x);
+                _mm_store_ps(ys, y);
+                write = keepLanes(a, write, read, xs, ys, alive, 4);
+            }
+        }
+        return integrateAndCullScalarRange(a, read, count, write, deltaTime, maxX, maxY);
+    }
+
+    KERNEL_TARGET("avx2")
+    std::size_t integrateAndCullAvx2(const ProjectileArrays& a, std::size_t count, float deltaTime, float maxX, float maxY) {
+        const __m256 dt = _mm256_set1_ps(deltaTime);
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256 limitX = _mm256_set1_ps(maxX);
+        const __m256 limitY = _mm256_set1_ps(maxY);
+
+        std::size_t read = 0;
+        std::size_t write = 0;
+        for (; read + 8 <= count; read += 8) {
+            const __m256 x0 = _mm256_loadu_ps(a.posX + read);
+            const __m256 y0 = _mm256_loadu_ps(a.posY + read);
+            const __m256 x = _mm256_add_ps(x0, _mm256_mul_ps(_mm256_loadu_ps(a.velX + read), dt));
+            const __m256 y = _mm256_add_ps(y0, _mm256_mul_ps(_mm256_loadu_ps(a.velY + read), dt));
+            const __m256 outside = _mm256_or_ps(
+                _mm256_or_ps(_mm256_cmp_ps(x, zero, _CMP_LT_OQ), _mm256_cmp_ps(x, limitX, _CMP_GT_OQ)),
+                _mm256_or_ps(_mm256_cmp_ps(y, zero, _CMP_LT_OQ), _mm256_cmp_ps(y, limitY, _CMP_GT_OQ)));
+            const unsigned int alive = ~static_cast<unsigned int>(_mm256_movemask_ps(outside)) & 0xFFu;
+
+            if (alive == 0xFFu) {
+                const __m256 vx = _mm256_loadu_ps(a.velX + read);
+                const __m256 vy = _mm256_loadu_ps(a.velY + read);
+                const __m256 r = _mm256_loadu_ps(a.radius + read);
+                const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a.color + read));
+                const __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a.slot + read));
+                _mm256_storeu_ps(a.prevX + write, x0);
+                _mm256_storeu_ps(a.prevY + write, y0);
+                _mm256_storeu_ps(a.posX + write, x);
+                _mm256_storeu_ps(a.posY + write, y);
+                _mm256_storeu_ps(a.velX + write, vx);
+                _mm256_storeu_ps(a.velY + write, vy);
+                _mm256_storeu_ps(a.radius + write, r);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(a.color + write), c);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(a.slot + write), s);
+                write += 8;
+            } else {
+                alignas(32) float xs[8];
+                alignas(32) float ys[8];
+                _mm256_store_ps(xs, x);
+                _mm256_store_ps(ys, y);
+                write = keepLanes(a, write, read, xs, ys, alive, 8);
+            }
+        }
+        // Clear the upper register halves before running SSE code again, or
+        // every later SSE instruction (libm included) pays a transition penalty
+        _mm256_zeroupper();
+        return integrateAndCullScalarRange(a, read, count, write, deltaTime, maxX, maxY);
+    }
+
+    KERNEL_TARGET("avx512f")
+    std::size_t integrateAndCullAvx512(const ProjectileArrays& a, std::size_t count, float deltaTime, float maxX, float maxY) {
+        const __m512 dt = _mm512_set1_ps(deltaTime);
+        const __m512 zero = _mm512_setzero_ps();
+        const __m512 limitX = _mm512_set1_ps(maxX);
+        const __m512 limitY = _mm512_set1_ps(maxY);
+
+        std::size_t read = 0;
+        std::size_t write = 0;
+        for (; read + 16 <= count; read += 16) {
+            const __m512 x0 = _mm512_loadu_ps(a.posX + read);
+            const __m512 y0 = _mm512_loadu_ps(a.posY + read);
+            const __m512 x = _mm512_add_ps(x0, _mm512_mul_ps(_mm512_loadu_ps(a.velX + read), dt));
+            const __m512 y = _mm512_add_ps(y0, _mm512_mul_ps(_mm512_loadu_ps(a.velY + read), dt));
+            const __mmask16 outside = static_cast<__mmask16>(
+                _mm512_cmp_ps_mask(x, zero, _CMP_LT_OQ) | _mm512_cmp_ps_mask(x, limitX, _CMP_GT_OQ) |
+                _mm512_cmp_ps_mask(y, zero, _CMP_LT_OQ) | _mm512_cmp_ps_mask(y, limitY, _CMP_GT_OQ));
+            const __mmask16 alive = static_cast<__mmask16>(~outside);
+
+            // Compress-store packs the surviving lanes contiguously at `write`
+            // and the culled lanes' slots onto the retired list
+            const __m512i s = _mm512_loadu_si512(a.slot + read);
+            _mm512_mask_compressstoreu_epi32(a.retiredSlots + (read - write), outside, s);
+            if (alive == 0) continue;
+
+            const __m512 vx = _mm512_loadu_ps(a.velX + read);
+            const __m512 vy = _mm512_loadu_ps(a.velY + read);
+            const __m512 r = _mm512_loadu_ps(a.radius + read);
+            const __m512i c = _mm512_loadu_si512(a.color + read);
+            _mm512_mask_compressstoreu_ps(a.prevX + write, alive, x0);
+            _mm512_mask_compressstoreu_ps(a.prevY + write, alive, y0);
+            _mm512_mask_compressstoreu_ps(a.posX + write, alive, x);
+            _mm512_mask_compressstoreu_ps(a.posY + write, alive, y);
+            _mm512_mask_compressstoreu_ps(a.velX + write, alive, vx);
+            _mm512_mask_compressstoreu_ps(a.velY + write, alive, vy);
+            _mm512_mask_compressstoreu_ps(a.radius + write, alive, r);
+            _mm512_mask_compressstoreu_epi32(a.color + write, alive, c);
+            _mm512_mask_compressstoreu_epi32(a.slot + write, alive, s);
+            write += countBits(alive);
+        }
+        _mm256_zeroupper();
+        return integrateAndCullScalarRange(a, read, count, write, deltaTime, maxX, maxY);
+    }
+#endif
+
+    SimdLevel queryCpu() {
+#if PROJECTILE_KERNELS_X86
+#if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 0);
+        const int maxLeaf = info[0];
+        __cpuid(info, 1);
+        const bool osSavesAvx = (info[2] & (1 << 27)) && (info[2] & (1 << 28));
+        const unsigned long long xcr0 = osSavesAvx ? _xgetbv(0) : 0;
+        bool avx2 = false;
+        bool avx512 = false;
+        if (maxLeaf >= 7) {
+            __cpuidex(info, 7, 0);
+            avx2 = (info[1] & (1 << 5)) && (xcr0 & 0x6) == 0x6;
+            avx512 = (info[1] & (1 << 16)) && (xcr0 & 0xE6) == 0xE6;
+        }
+        if (avx512) return SimdLevel::AVX512;
+        if (avx2) return SimdLevel::AVX2;
+#else
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) return SimdLevel::AVX512;
+        if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+#endif
+        return SimdLevel::SSE2;
+#else
+        return SimdLevel::Scalar;
+#endif
+    }
+
+    KernelFn kernelFor(SimdLevel level) {
+        switch (level) {
+#if PROJECTILE_KERNELS_X86
+            case SimdLevel::AVX512: return integrateAndCullAvx512;
+            case SimdLevel::AVX2: return integrateAndCullAvx2;
+            case SimdLevel::SSE2: return integrateAndCullSse2;
+#endif
+            default: return integrateAndCullScalar;
+        }
+    }
+}
+
+SimdLevel detectSimdLevel() {
+    static const SimdLevel level = queryCpu();
+    return level;
+}
+
+const char* simdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::SSE2: return "SSE2";
+        case SimdLevel::AVX2: return "AVX2";
+        case SimdLevel::AVX512: return "AVX-512";
+        default: return "Scalar";
+    }
+}
+
+std::size_t integrateAndCull(const ProjectileArrays& arrays, std::size_t count, float deltaTime, float maxX, float maxY) {
+    static const KernelFn kernel = kernelFor(detectSimdLevel());
+    return kernel(arrays, count, deltaTime, maxX, maxY);
+}
+
+std::size_t integrateAndCull(SimdLevel level, const ProjectileArrays& arrays, std::size_t count, float deltaTime, float maxX, float maxY) {
+    if (level > detectSimdLevel()) level = detectSimdLevel();
+    return kernelFor(level)(arrays, count, deltaTime, maxX, maxY);
+}
+
+std::size_t integrateAndCull(JobSystem& jobs, std::size_t grain, const ProjectileArrays& arrays, std::size_t count,
+                             float deltaTime, float maxX, float maxY) {
+    if (count <= grain || jobs.getThreadCount() == 1) {
+        return integrateAndCull(arrays, count, deltaTime, maxX, maxY);
+    }
+
+    // Each chunk compacts in place: survivors to its front, retired slots to
+    // the front of its own range of retiredSlots
+    const std::size_t chunkCount = (count + grain - 1) / grain;
+    // Named through a reference: a lambda running on a worker would otherwise
+    // see that thread's own copy of the thread_local
+    static thread_local std::vector<std::size_t> survivorScratch;
+    std::vector<std::size_t>& chunkSurvivors = survivorScratch;
+    chunkSurvivors.resize(chunkCount);
+    auto runChunk = [&](std::size_t begin, std::size_t end) {
+        const ProjectileArrays chunk{
+            arrays.posX + begin, arrays.posY + begin, arrays.prevX + begin, arrays.prevY + begin,
+            arrays.velX + begin, arrays.velY + begin, arrays.radius + begin, arrays.color + begin,
+            arrays.slot + begin, arrays.retiredSlots + begin
+        };
+        chunkSurvivors[begin / grain] = integrateAndCull(chunk, end - begin, deltaTime, maxX, maxY);
+    };
+    jobs.parallelFor(count, grain, runChunk);
+
+    // Close the gaps between chunks. Destinations never pass their sources,
+    // so copying front to back is safe.
+    std::size_t survivors = chunkSurvivors[0];
+    std::size_t retired = grain - chunkSurvivors[0];
+    for (std::size_t c = 1; c < chunkCount; ++c) {
+        const std::size_t begin = c * grain;
+        const std::size_t kept = chunkSurvivors[c];
+        const std::size_t culled = std::min(grain, count - begin) - kept;
+        if (survivors != begin) {
+            std::copy(arrays.posX + begin, arrays.posX + begin + kept, arrays.posX + survivors);
+            std::copy(arrays.posY + begin, arrays.posY + begin + kept, arrays.posY + survivors);
+            std::copy(arrays.prevX + begin, arrays.prevX + begin + kept, arrays.prevX + survivors);
+            std::copy(arrays.prevY + begin, arrays.prevY + begin + kept, arrays.prevY + survivors);
+            std::copy(arrays.velX + begin, arrays.velX + begin + kept, arrays.velX + survivors);
+            std::copy(arrays.velY + begin, arrays.velY + begin + kept, arrays.velY + survivors);
+            std::copy(arrays.radius + begin, arrays.radius + begin + kept, arrays.radius + survivors);
+            std::copy(arrays.color + begin, arrays.color + begin + kept, arrays.color + survivors);
+            std::copy(arrays.slot + begin, arrays.slot + begin + kept, arrays.slot + survivors);
+        }
+        if (retired != begin) {
+            std::copy(arrays.retiredSlots + begin, arrays.retiredSlots + begin + culled, arrays.retiredSlots + retired);
+        }
+        survivors += kept;
+        retired += culled;
+    }
+    return survivors;
+}
@@ -0,0 +1,269 @@
+#include "ProjectileStore.hpp"
+#include "StateBuffer.hpp"
+
+#include <algorithm>
+
+namespace {
+    // Spare storage behind the packed range, as a fraction of the capacity. A
+    // full pool moves its projectiles back to the front once every
+    // capacity / SPARE_DIVISOR drops, a few element copies per drop.
+    constexpr std::size_t SPARE_DIVISOR = 4;
+
+    template <typename T>
+    void moveElements(std::vector<T>& values, std::size_t first, std::size_t last, std::size_t to) {
+        if (to < first) {
+            std::copy(values.begin() + first, values.begin() + last, values.begin() + to);
+        } else {
+            std::copy_backward(values.begin() + first, values.begin() + last, values.begin() + to + (last - first));
+        }
+    }
+}
+
+ProjectileStore::ProjectileStore(std::size_t capacity, PoolOverflowPolicy policy)
+    : poolCapacity(capacity),
+      head(0),
+      count(0),
+      freeCount(0),
+      overflowPolicy(policy),
+      droppedCount(0),
+      refusedCount(0),
+      posX(capacity + capacity / SPARE_DIVISOR + 1),
+      posY(capacity + capacity / SPARE_DIVISOR + 1),
+      prevX(capacity + capacity / SPARE_DIVISOR + 1),
+      prevY(capacity + capacity / SPARE_DIVISOR + 1),
+      velX(capacity + capacity / SPARE_DIVISOR + 1),
+      velY(capacity + capacity / SPARE_DIVISOR + 1),
+      radius(capacity + capacity / SPARE_DIVISOR + 1),
+      color(capacity + capacity / SPARE_DIVISOR + 1),
+      slotOf(capacity + capacity / SPARE_DIVISOR + 1),
+      denseIndex(capacity),
+      generation(capacity, 1),
+      freeSlots(capacity),
+      retiredSlots(capacity)
+{
+    clear();
+}
+
+ProjectileHandle ProjectileStore::add(const sf::Vector2f& position, const sf::Vector2f& velocity, float r, std::uint32_t c) {
+    if (count == capacity()) {
+        if (overflowPolicy == PoolOverflowPolicy::Refuse || count == 0) {
+            ++refusedCount;
+            return ProjectileHandle{};
+        }
+        removeAt(0); // Oldest projectile lives at the head
+        ++droppedCount;
+    }
+    if (head + count == posX.size()) {
+        moveRange(head, head + count, 0); // Out of spare room at the back
+        head = 0;
+    }
+
+    const std::uint32_t slot = acquireSlot();
+    const std::size_t index = head + count++;
+    posX[index] = position.x;
+    posY[index] = position.y;
+    prevX[index] = position.x;
+    prevY[index] = position.y;
+    velX[index] = velocity.x;
+    velY[index] = velocity.y;
+    radius[index] = r;
+    color[index] = c;
+    slotOf[index] = slot;
+    denseIndex[slot] = static_cast<std::uint32_t>(index);
+    return ProjectileHandle{slot, generation[slot]};
+}
+
+bool ProjectileStore::remove(ProjectileHandle handle) {
+    const std::size_t index = indexOf(handle);
+    if (index == npos) return false;
+    removeAt(index);
+    return true;
+}
+
+void ProjectileStore::removeAt(std::size_t index) {
+    const std::size_t at = head + index;
+    releaseSlot(slotOf[at]);
+
+    // Close the gap from the shorter side so projectiles stay in spawn order
+    if (index < count / 2) {
+        moveRange(head, at, head + 1);
+        ++head;
+    } else {
+        moveRange(at + 1, head + count, at);
+    }
+    --count;
+}
+
+void ProjectileStore::clear() {
+    for (std::size_t i = head; i < head + count; ++i) {
+        bumpGeneration(slotOf[i]);
+    }
+    head = 0;
+    count = 0;
+
+    // Hand out low slots first
+    freeCount = freeSlots.size();
+    for (std::size_t i = 0; i < freeCount; ++i) {
+        freeSlots[i] = static_cast<std::uint32_t>(freeCount - 1 - i);
+    }
+}
+
+void ProjectileStore::commitCull(std::size_t survivors) {
+    if (survivors == count) return; // Nothing retired, so nothing moved
+
+    for (std::size_t i = 0; i < count - survivors; ++i) {
+        releaseSlot(retiredSlots[i]);
+    }
+    count = survivors;
+    for (std::size_t i = head; i < head + count; ++i) {
+        denseIndex[slotOf[i]] = static_cast<std::uint32_t>(i);
+    }
+}
+
+void ProjectileStore::retireSorted(const std::uint32_t* indices, std::size_t indexCount) {
+    if (indexCount == 0) return;
+
+    // Everything before the first retired index is already in place
+    std::size_t write = head + indices[0];
+    std::size_t next = 0;
+    for (std::size_t read = write; read < head + count; ++read) {
+        if (next < indexCount && head + indices[next] == read) {
+            retiredSlots[next++] = slotOf[read];
+            continue;
+        }
+        posX[write] = posX[read];
+        posY[write] = posY[read];
+        prevX[write] = prevX[read];
+        prevY[write] = prevY[read];
+        velX[write] = velX[read];
+        velY[write] = velY[read];
+        radius[write] = radius[read];
+        color[write] = color[read];
+        slotOf[write] = slotOf[read];
+        ++write;
+    }
+    commitCull(write - head);
+}
+
+void ProjectileStore::saveArrays(StateBuffer& out) const {
+    out.writeArray(posX.data() + head, count);
+    out.writeArray(posY.data() + head, count);
+    out.writeArray(prevX.data() + head, count);
+    out.writeArray(prevY.data() + head, count);
+    out.writeArray(velX.data() + head, count);
+    out.writeArray(velY.data() + head, count);
+    out.writeArray(radius.data() + head, count);
+    out.writeArray(color.data() + head, count);
+}
+
+bool ProjectileStore::loadArrays(StateReader& in, std::size_t loadCount) {
+    if (loadCount > capacity()) return false;
+    clear();
+    in.readArray(posX.data(), loadCount);
+    in.readArray(posY.data(), loadCount);
+    in.readArray(prevX.data(), loadCount);
+    in.readArray(prevY.data(), loadCount);
+    in.readArray(velX.data(), loadCount);
+    in.readArray(velY.data(), loadCount);
+    in.readArray(radius.data(), loadCount);
+    in.readArray(color.data(), loadCount);
+    if (!in.ok()) return false; // Leaves the pool empty rather than half loaded
+
+    for (std::size_t i = 0; i < loadCount; ++i) {
+        const std::uint32_t slot = acquireSlot();
+        slotOf[i] = slot;
+        denseIndex[slot] = static_cast<std::uint32_t>(i);
+    }
+    count = loadCount;
+    return true;
+}
+
+std::size_t ProjectileStore::savedBytes(std::size_t projectileCount) {
+    return projectileCount * (7 * sizeof(float) + sizeof(std::uint32_t));
+}
+
+std::size_t ProjectileStore::size() const {
+    return count;
+}
+
+bool ProjectileStore::empty() const {
+    return count == 0;
+}
+
+std::size_t ProjectileStore::capacity() const {
+    return poolCapacity;
+}
+
+PoolOverflowPolicy ProjectileStore::getOverflowPolicy() const {
+    return overflowPolicy;
+}
+
+std::size_t ProjectileStore::getDroppedCount() const {
+    return droppedCount;
+}
+
+std::size_t ProjectileStore::getRefusedCount() const {
+    return refusedCount;
+}
+
+ProjectileView ProjectileStore::operator[](std::size_t index) const {
+    index += head;
+    return ProjectileView{
+        sf::Vector2f(posX[index], posY[index]),
+        sf::Vector2f(velX[index], velY[index]),
+        radius[index],
+        color[index]
+    };
+}
+
+ProjectileHandle ProjectileStore::handleAt(std::size_t index) const {
+    const std::uint32_t slot = slotOf[head + index];
+    return ProjectileHandle{slot, generation[slot]};
+}
+
+std::size_t ProjectileStore::indexOf(ProjectileHandle handle) const {
+    if (!handle.isValid() || handle.slot >= generation.size() || generation[handle.slot] != handle.generation) {
+        return npos;
+    }
+    return denseIndex[handle.slot] - head;
+}
+
+bool ProjectileStore::isAlive(ProjectileHandle handle) const {
+    return indexOf(handle) != npos;
+}
+
+ProjectileArrays ProjectileStore::arrays() {
+    return ProjectileArrays{
+        posX.data() + head, posY.data() + head, prevX.data() + head, prevY.data() + head, velX.data() + head,
+        velY.data() + head, radius.data() + head, color.data() + head, slotOf.data() + head, retiredSlots.data()
+    };
+}
+
+std::uint32_t ProjectileStore::acquireSlot() {
+    return freeSlots[--freeCount];
+}
+
+void ProjectileStore::releaseSlot(std::uint32_t slot) {
+    // Outstanding handles to this projectile go stale
+    bumpGeneration(slot);
+    freeSlots[freeCount++] = slot;
+}
+
+void ProjectileStore::bumpGeneration(std::uint32_t slot) {
+    if (++generation[slot] == 0) generation[slot] = 1; // Skip the invalid generation on wrap
+}
+
+void ProjectileStore::moveRange(std::size_t first, std::size_t last, std::size_t to) {
+    moveElements(posX, first, last, to);
+    moveElements(posY, first, last, to);
+    moveElements(prevX, first, last, to);
+    moveElements(prevY, first, last, to);
+    moveElements(velX, first, last, to);
+    moveElements(velY, first, last, to);
+    moveElements(radius, first, last, to);
+    moveElements(color, first, last, to);
+    moveElements(slotOf, first, last, to);
+    for (std::size_t i = to; i < to + (last - first); ++i) {
+        denseIndex[slotOf[i]] = static_cast<std::uint32_t>(i);
+    }
+}
@@ -0,0 +1,129 @@
+#include "RenderQueue.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace {
+    // Sort key, most significant first: layer, blend, texture, primitive,
+    // then submission order
+    constexpr unsigned int SEQUENCE_BITS = 32;
+    constexpr unsigned int PRIMITIVE_SHIFT = SEQUENCE_BITS;
+    constexpr unsigned int TEXTURE_SHIFT = PRIMITIVE_SHIFT + 3;
+    constexpr unsigned int BLEND_SHIFT = TEXTURE_SHIFT + 8;
+    constexpr unsigned int LAYER_SHIFT = BLEND_SHIFT + 2;
+
+    bool isList(sf::PrimitiveType primitive) {
+        return primitive == sf::Points || primitive == sf::Lines || primitive == sf::Triangles || primitive == sf::Quads;
+    }
+
+    sf::BlendMode blendMode(RenderBlend blend) {
+        return blend == RenderBlend::Add ? sf::BlendAdd : sf::BlendAlpha;
+    }
+}
+
+RenderQueue::RenderQueue()
+    : textures{},
+      textureCount(0),
+      drawCalls(0),
+      commandCount(0) {}
+
+void RenderQueue::clear() {
+    commands.clear();
+    vertices.clear();
+}
+
+sf::Vertex* RenderQueue::push(RenderLayer layer, sf::PrimitiveType primitive, const sf::Texture* texture, RenderBlend blend,
+                              std::size_t vertexCount) {
+    assert(isList(primitive) && "Strips and fans can't be merged");
+    const std::uint64_t key = static_cast<std::uint64_t>(layer) << LAYER_SHIFT
+                            | static_cast<std::uint64_t>(blend) << BLEND_SHIFT
+                            | textureId(texture) << TEXTURE_SHIFT
+                            | static_cast<std::uint64_t>(primitive) << PRIMITIVE_SHIFT
+                            | static_cast<std::uint64_t>(commands.size());
+    const std::size_t first = vertices.size();
+    commands.push_back(Command{key, static_cast<std::uint32_t>(first), static_cast<std::uint32_t>(vertexCount),
+                               texture, primitive, blend});
+    vertices.resize(first + vertexCount);
+    return vertices.data() + first;
+}
+
+void RenderQueue::push(RenderLayer layer, const sf::VertexArray& array, const sf::Texture* texture, RenderBlend blend) {
+    const std::size_t count = array.getVertexCount();
+    if (count == 0) return;
+    sf::Vertex* out = push(layer, array.getPrimitiveType(), texture, blend, count);
+    std::copy(&array[0], &array[0] + count, out);
+}
+
+void RenderQueue::shrinkLast(std::size_t vertexCount) {
+    if (commands.empty()) return;
+    Command& last = commands.back();
+    last.vertexCount = std::min(last.vertexCount, static_cast<std::uint32_t>(vertexCount));
+    vertices.resize(last.firstVertex + last.vertexCount);
+}
+
+void RenderQueue::submit(sf::RenderTarget& target) {
+    std::sort(commands.begin(), commands.end(), [](const Command& a, const Command& b) { return a.key < b.key; });
+
+    drawCalls = 0;
+    commandCount = commands.size();
+    std::size_t first = 0;
+    while (first < commands.size()) {
+        const std::uint64_t state = commands[first].key >> SEQUENCE_BITS;
+        std::size_t end = first + 1;
+        while (end < commands.size() && (commands[end].key >> SEQUENCE_BITS) == state
+               && commands[end].texture == commands[first].texture) { // Ids run out past MAX_TEXTURES
+            ++end;
+        }
+        draw(target, first, end);
+        first = end;
+    }
+    clear();
+}
+
+// One call for commands [first, end), which share all their state
+void RenderQueue::draw(sf::RenderTarget& target, std::size_t first, std::size_t end) {
+    std::size_t total = 0;
+    bool adjacent = true;
+    for (std::size_t i = first; i < end; ++i) {
+        total += commands[i].vertexCount;
+        if (i > first && commands[i].firstVertex != commands[i - 1].firstVertex + commands[i - 1].vertexCount) {
+            adjacent = false;
+        }
+    }
+    if (total == 0) return;
+
+    const sf::Vertex* batch = vertices.data() + commands[first].firstVertex;
+    if (!adjacent) {
+        gathered.clear();
+        for (std::size_t i = first; i < end; ++i) {
+            const sf::Vertex* begin = vertices.data() + commands[i].firstVertex;
+            gathered.insert(gathered.end(), begin, begin + commands[i].vertexCount);
+        }
+        batch = gathered.data();
+    }
+
+    const Command& command = commands[first];
+    const sf::RenderStates states(blendMode(command.blend), sf::Transform::Identity, command.texture, nullptr);
+    target.draw(batch, total, command.primitive, states);
+    ++drawCalls;
+}
+
+// Small ids for the sort key, handed out on first use. A renderer has a few
+// textures at most, so a linear search is plenty.
+std::uint64_t RenderQueue::textureId(const sf::Texture* texture) {
+    if (!texture) return 0;
+    for (std::size_t i = 0; i < textureCount; ++i) {
+        if (textures[i] == texture) return i + 1;
+    }
+    if (textureCount == MAX_TEXTURES) return MAX_TEXTURES; // Shared from here on; still drawn right, just batched less
+    textures[textureCount++] = texture;
+    return textureCount;
+}
+
+unsigned int RenderQueue::getDrawCalls() const {
+    return drawCalls;
+}
+
+std::size_t RenderQueue::getCommandCount() const {
+    return commandCount;
+}
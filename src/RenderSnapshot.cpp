@@ -0,0 +1,51 @@
+#include "RenderSnapshot.hpp"
+
+#include <algorithm>
+
+void RenderBodies::reserve(std::size_t capacity) {
+    if (capacity <= x.size()) return;
+    x.resize(capacity);
+    y.resize(capacity);
+    prevX.resize(capacity);
+    prevY.resize(capacity);
+    radius.resize(capacity);
+    color.resize(capacity);
+}
+
+void RenderBodies::copyFrom(const float* curX, const float* curY, const float* previousX, const float* previousY,
+                            const float* radii, const std::uint32_t* colors, std::size_t bodyCount) {
+    reserve(bodyCount); // Only allocates if the source outgrew the initial reserve
+    std::copy(curX, curX + bodyCount, x.begin());
+    std::copy(curY, curY + bodyCount, y.begin());
+    std::copy(previousX, previousX + bodyCount, prevX.begin());
+    std::copy(previousY, previousY + bodyCount, prevY.begin());
+    std::copy(radii, radii + bodyCount, radius.begin());
+    std::copy(colors, colors + bodyCount, color.begin());
+    count = bodyCount;
+}
+
+void RenderBodies::gatherFrom(const float* curX, const float* curY, const float* previousX, const float* previousY,
+                              const float* radii, const std::uint32_t* colors, const std::uint32_t* indices,
+                              std::size_t indexCount) {
+    reserve(indexCount);
+    for (std::size_t i = 0; i < indexCount; ++i) {
+        const std::uint32_t index = indices[i];
+        x[i] = curX[index];
+        y[i] = curY[index];
+        prevX[i] = previousX[index];
+        prevY[i] = previousY[index];
+        radius[i] = radii[index];
+        color[i] = colors[index];
+    }
+    count = indexCount;
+}
+
+void EffectEvents::clear() {
+    thrusting = false;
+    shots = 0;
+    impactCount = 0;
+}
+
+void EffectEvents::addImpact(const sf::Vector2f& position) {
+    if (impactCount < MAX_IMPACTS) impacts[impactCount++] = position;
+}
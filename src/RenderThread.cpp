@@ -0,0 +1,63 @@
+#include "RenderThread.hpp"
+#include "FrameRenderer.hpp"
+
+RenderThread::RenderThread(FrameRenderer& renderer)
+    : renderer(renderer), window(nullptr), running(false) {}
+
+RenderThread::~RenderThread() {
+    stop();
+}
+
+void RenderThread::reserve(std::size_t projectileCapacity, std::size_t asteroidCapacity) {
+    for (std::uint32_t i = 0; i < 3; ++i) {
+        snapshots.slot(i).projectiles.reserve(projectileCapacity);
+        snapshots.slot(i).asteroids.reserve(asteroidCapacity);
+    }
+}
+
+void RenderThread::start(sf::RenderWindow& target) {
+    if (running) return;
+    window = &target;
+    window->setActive(false); // A context can only be current on one thread
+    running = true;
+    thread = std::thread(&RenderThread::loop, this);
+}
+
+void RenderThread::stop() {
+    if (!running) return;
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        running = false;
+    }
+    wakeUp.notify_one();
+    thread.join();
+    window->setActive(true);
+}
+
+bool RenderThread::isRunning() const {
+    return running;
+}
+
+RenderSnapshot& RenderThread::snapshot() {
+    return snapshots.back();
+}
+
+bool RenderThread::publish() {
+    const bool skipped = snapshots.publish();
+    std::lock_guard<std::mutex> lock(wakeMutex);
+    wakeUp.notify_one();
+    return skipped;
+}
+
+void RenderThread::loop() {
+    window->setActive(true);
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            wakeUp.wait(lock, [this] { return !running || snapshots.acquire(); });
+            if (!running) break;
+        }
+        renderer.render(*window, snapshots.front());
+    }
+    window->setActive(false);
+}
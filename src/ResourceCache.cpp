@@ -0,0 +1,135 @@
+#include "ResourceCache.hpp"
+#include "AssetPack.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+namespace {
+    // sf::Font streams glyphs from its source on demand, so the file's bytes
+    // have to outlive it. Keeping them together means one allocation, one read.
+    struct LoadedFont {
+        std::vector<char> data;
+        sf::Font font;
+    };
+
+    // A second font over a cached font's bytes, holding on to their owner
+    struct FontInstance {
+        std::shared_ptr<const void> source;
+        sf::Font font;
+    };
+
+    constexpr std::size_t BYTES_PER_PIXEL = 4;
+
+    bool readFile(const std::string& path, std::vector<char>& out) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) return false;
+        out.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return true;
+    }
+}
+
+void ResourceCache::setAssetPack(const AssetPack* assetPack) {
+    pack = assetPack;
+}
+
+void ResourceCache::setAssetDirectory(const std::string& directory) {
+    assetDirectory = directory;
+}
+
+const ResourceCache::Entry* ResourceCache::find(const std::string& key) {
+    const auto it = entries.find(key);
+    if (it == entries.end()) {
+        ++misses;
+        return nullptr;
+    }
+    ++hits;
+    return &it->second;
+}
+
+std::string ResourceCache::diskPath(const std::string& name) const {
+    return assetDirectory + "/" + name;
+}
+
+FontHandle ResourceCache::getFont(const std::string& name) {
+    const std::string key = AssetPack::normalizeName(name);
+    if (const Entry* entry = find(key)) {
+        return std::static_pointer_cast<const sf::Font>(entry->resource);
+    }
+
+    Entry entry{nullptr, 0, false, nullptr};
+    const AssetView view = pack ? pack->find(name) : AssetView();
+    if (view) {
+        // Straight from the mapping: no read, no copy
+        auto font = std::make_shared<sf::Font>();
+        if (font->loadFromMemory(view.data, view.size)) {
+            entry = Entry{font, view.size, true, view.data};
+        }
+    } else {
+        auto loaded = std::make_shared<LoadedFont>();
+        if (readFile(diskPath(name), loaded->data) && loaded->font.loadFromMemory(loaded->data.data(), loaded->data.size())) {
+            // Shares ownership of the bytes
+            entry = Entry{FontHandle(loaded, &loaded->font), loaded->data.size(), false, loaded->data.data()};
+        }
+    }
+    if (!entry.resource) {
+        std::cerr << "Error loading font: " << name << std::endl;
+    }
+    entries[key] = entry;
+    return std::static_pointer_cast<const sf::Font>(entry.resource);
+}
+
+FontHandle ResourceCache::getFontInstance(const std::string& name) {
+    if (!getFont(name)) return nullptr;
+    const Entry& entry = entries[AssetPack::normalizeName(name)];
+
+    auto instance = std::make_shared<FontInstance>();
+    instance->source = entry.resource;
+    if (!instance->font.loadFromMemory(entry.source, entry.bytes)) {
+        std::cerr << "Error loading font: " << name << std::endl;
+        return nullptr;
+    }
+    return FontHandle(instance, &instance->font);
+}
+
+TextureHandle ResourceCache::getTexture(const std::string& name) {
+    const std::string key = AssetPack::normalizeName(name);
+    if (const Entry* entry = find(key)) {
+        return std::static_pointer_cast<const sf::Texture>(entry->resource);
+    }
+
+    // Textures are decoded and uploaded, so nothing points back at the source
+    Entry entry{nullptr, 0, false, nullptr};
+    auto texture = std::make_shared<sf::Texture>();
+    const AssetView view = pack ? pack->find(name) : AssetView();
+    if (view ? texture->loadFromMemory(view.data, view.size) : texture->loadFromFile(diskPath(name))) {
+        entry = Entry{texture, static_cast<std::size_t>(texture->getSize().x) * texture->getSize().y * BYTES_PER_PIXEL, false,
+                      nullptr};
+    } else {
+        std::cerr << "Error loading texture: " << name << std::endl;
+    }
+    entries[key] = entry;
+    return std::static_pointer_cast<const sf::Texture>(entry.resource);
+}
+
+void ResourceCache::releaseUnused() {
+    for (auto it = entries.begin(); it != entries.end();) {
+        if (it->second.resource.use_count() <= 1) {
+            it = entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+ResourceCacheStats ResourceCache::getStats() const {
+    ResourceCacheStats stats;
+    stats.hits = hits;
+    stats.misses = misses;
+    stats.entries = entries.size();
+    for (const auto& entry : entries) {
+        (entry.second.mapped ? stats.mappedBytes : stats.residentBytes) += entry.second.bytes;
+    }
+    return stats;
+}
@@ -0,0 +1,46 @@
+#include "ShipControl.hpp"
+#include "Player.hpp"
+#include "Attack.hpp"
+
+namespace {
+    // Rotation
+    constexpr float NORMAL_ROTATION_SPEED_DEG_S = 180.0f;
+    constexpr float FAST_ROTATION_SPEED_DEG_S = 360.0f;
+
+    // Movement
+    constexpr float FORWARD_FORCE_UNIT = 1.0f;
+
+    // Attack
+    constexpr float ATTACK_ANGLE_ROTATION_FACTOR = 0.5f;
+}
+
+float applyShipControls(Player& player, const TickInput& input, float tickDelta) {
+    float rotationSpeed = 0.f;
+    const float turnSpeed = input.fastRotate ? FAST_ROTATION_SPEED_DEG_S : NORMAL_ROTATION_SPEED_DEG_S;
+    if (input.rotateLeft) {
+        rotationSpeed = -turnSpeed;
+    } else if (input.rotateRight) {
+        rotationSpeed = turnSpeed;
+    }
+    player.handleRotation(rotationSpeed, tickDelta);
+
+    float force = input.moveForward ? FORWARD_FORCE_UNIT : 0.f;
+    player.applyMovementForce(force, tickDelta, player.getRotation());
+    player.updateMovement(tickDelta, force);
+    return rotationSpeed * tickDelta;
+}
+
+void applyShipAttack(Player& player, Attack& attack, bool& attackToggle, const TickInput& input, float tickDelta,
+                     float rotationApplied, const sf::Vector2f& worldSize) {
+    sf::Vector2f playerPos = player.getPosition();
+    bool playerInWorld = playerPos.x > 0 && playerPos.x < worldSize.x && playerPos.y > 0 && playerPos.y < worldSize.y;
+
+    if (playerInWorld && input.toggleAttack) {
+        attackToggle = !attackToggle;
+    }
+
+    // Projectiles keep moving every tick so interpolation stays smooth;
+    // only firing is limited to when the player is inside the world
+    float attackAngle = player.getRotation() + (rotationApplied * ATTACK_ANGLE_ROTATION_FACTOR);
+    attack.update(tickDelta, playerPos, attackAngle, attackToggle && playerInWorld);
+}
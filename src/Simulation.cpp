@@ -0,0 +1,198 @@
+#include "Simulation.hpp"
+#include "Profiler.hpp"
+#include "JobSystem.hpp"
+#include "ShipControl.hpp"
+#include "StateBuffer.hpp"
+
+#include <algorithm>
+
+namespace {
+    // Asteroids
+    constexpr std::size_t ASTEROID_CAPACITY = 65536;
+    constexpr std::uint32_t ASTEROID_SEED = 0xA57E801Du;
+    constexpr std::size_t ASTEROID_JOB_GRAIN = 4096;
+}
+
+Simulation::Simulation(const sf::Vector2f& worldSize)
+    : worldSize(worldSize),
+      player(worldSize.x / 2.f, worldSize.y / 2.f),
+      attack(),
+      asteroids(ASTEROID_CAPACITY),
+      collider(),
+      impacts(),
+      attackToggle(false),
+      tickCount(0),
+      jobSystem(nullptr)
+{
+    attack.setWorldSize(worldSize);
+    collider.setWorldSize(worldSize);
+}
+
+void Simulation::step(float tickDelta, InputSource& input) {
+    step(tickDelta, input.nextTick());
+}
+
+void Simulation::step(float tickDelta, const TickInput& input) {
+    // Asteroids do not depend on the player or projectiles, so they move and
+    // are binned into the collision grid on the job system while this thread
+    // runs the rest; collision waits for both. Binning only needs the padding
+    // up front: projectiles keep their radius, and new ones get the current size.
+    JobCounter asteroidsMoved;
+    JobCounter asteroidsBinned;
+    const float padding = std::max(ProjectileCollider::maxRadius(attack.getProjectiles()), attack.getProjectileSize());
+    auto moveAsteroids = [this, tickDelta] { updateAsteroids(tickDelta); };
+    auto binAsteroids = [this, padding] { collider.prepare(asteroids.bodies(), padding); };
+    if (jobSystem) {
+        jobSystem->submit(asteroidsMoved, moveAsteroids);
+        jobSystem->submit(asteroidsBinned, binAsteroids, &asteroidsMoved);
+    }
+
+    player.storePreviousState();
+    float rotationApplied;
+    {
+        PROFILE_SCOPE("Player");
+        rotationApplied = applyShipControls(player, input, tickDelta);
+    }
+    {
+        PROFILE_SCOPE("Attack");
+        applyShipAttack(player, attack, attackToggle, input, tickDelta, rotationApplied, worldSize);
+    }
+    {
+        PROFILE_SCOPE("Asteroids");
+        if (jobSystem) {
+            jobSystem->wait(asteroidsBinned);
+        } else {
+            moveAsteroids();
+            binAsteroids();
+        }
+    }
+    {
+        PROFILE_SCOPE("Collision");
+        resolveHits();
+    }
+    ++tickCount;
+}
+
+// Projectiles that hit an asteroid are retired in one batch, then the
+// asteroids take their damage. The asteroids are already in the grid.
+void Simulation::resolveHits() {
+    const std::vector<CollisionPair>& hits = collider.query(attack.getProjectiles());
+    const std::vector<std::uint32_t>& hitProjectiles = collider.getHitProjectiles();
+    const ProjectileStore& projectiles = attack.getProjectiles();
+    impacts.clear();
+    for (std::uint32_t index : hitProjectiles) {
+        impacts.emplace_back(projectiles.positionsX()[index], projectiles.positionsY()[index]);
+    }
+    attack.retireProjectiles(hitProjectiles.data(), hitProjectiles.size());
+    asteroids.applyHits(hits);
+}
+
+void Simulation::setWorldSize(const sf::Vector2f& size) {
+    worldSize = size;
+    attack.setWorldSize(size);
+    collider.setWorldSize(size);
+}
+
+void Simulation::updateAsteroids(float tickDelta) {
+    if (!jobSystem) {
+        asteroids.update(tickDelta, worldSize);
+        return;
+    }
+    auto updateRange = [this, tickDelta](std::size_t begin, std::size_t end) {
+        asteroids.updateRange(begin, end, tickDelta, worldSize);
+    };
+    jobSystem->parallelFor(asteroids.size(), ASTEROID_JOB_GRAIN, updateRange);
+}
+
+void Simulation::setJobSystem(JobSystem* jobs) {
+    jobSystem = jobs;
+    attack.setJobSystem(jobs);
+    collider.setJobSystem(jobs);
+}
+
+void Simulation::saveState(StateBuffer& out) const {
+    SimulationState state;
+    state.tickCount = tickCount;
+    state.worldSize = worldSize;
+    state.player = player.getState();
+    state.attack = attack.getState();
+    state.attackToggle = attackToggle;
+    state.projectileCount = static_cast<std::uint32_t>(attack.getProjectiles().size());
+    state.asteroidCount = static_cast<std::uint32_t>(asteroids.size());
+    state.asteroidsDestroyed = asteroids.getDestroyedCount();
+    out.write(state);
+    attack.getProjectiles().saveArrays(out);
+    asteroids.saveArrays(out);
+}
+
+bool Simulation::loadState(StateReader& in) {
+    SimulationState state;
+    in.read(state);
+    if (!in.ok()) return false;
+    if (state.projectileCount > attack.getProjectiles().capacity() || state.asteroidCount > asteroids.capacity()) {
+        return false; // Saved before a pool was resized
+    }
+    // Both pools are replaced below, so a truncated snapshot has to be caught
+    // before either is touched
+    if (in.remaining() < ProjectileStore::savedBytes(state.projectileCount) + AsteroidField::savedBytes(state.asteroidCount)) {
+        return false;
+    }
+    if (!attack.loadProjectiles(in, state.projectileCount) ||
+        !asteroids.loadArrays(in, state.asteroidCount, state.asteroidsDestroyed)) {
+        return false;
+    }
+    setWorldSize(state.worldSize);
+    player.setState(state.player);
+    attack.setState(state.attack);
+    attackToggle = state.attackToggle;
+    tickCount = state.tickCount;
+    return true;
+}
+
+std::size_t Simulation::spawnAsteroids(std::size_t count) {
+    return asteroids.spawnRandom(count, worldSize, ASTEROID_SEED);
+}
+
+const std::vector<CollisionPair>& Simulation::getHits() const {
+    return collider.getHits();
+}
+
+const std::vector<sf::Vector2f>& Simulation::getImpacts() const {
+    return impacts;
+}
+
+sf::Vector2f Simulation::getWorldSize() const {
+    return worldSize;
+}
+
+std::uint64_t Simulation::getTickCount() const {
+    return tickCount;
+}
+
+bool Simulation::isAttackToggled() const {
+    return attackToggle;
+}
+
+Player& Simulation::getPlayer() {
+    return player;
+}
+
+Attack& Simulation::getAttack() {
+    return attack;
+}
+
+const Player& Simulation::getPlayer() const {
+    return player;
+}
+
+const Attack& Simulation::getAttack() const {
+    return attack;
+}
+
+AsteroidField& Simulation::getAsteroids() {
+    return asteroids;
+}
+
+const AsteroidField& Simulation::getAsteroids() const {
+    return asteroids;
+}
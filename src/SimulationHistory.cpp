@@ -0,0 +1,140 @@
+#include "SimulationHistory.hpp"
+#include "Simulation.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    float microsecondsSince(Clock::time_point start) {
+        return std::chrono::duration<float, std::micro>(Clock::now() - start).count();
+    }
+}
+
+SimulationHistory::SimulationHistory(std::size_t tickCapacity, std::size_t keyframeInterval)
+    : tickCapacity(0),
+      keyframeInterval(1),
+      recording(false),
+      baseTick(0),
+      endTick(0),
+      captureUsTotal(0.0),
+      ticksRecorded(0),
+      lastKeyframeUs(0.f),
+      lastSeekMs(0.f),
+      lastSeekTicks(0)
+{
+    configure(tickCapacity, keyframeInterval);
+}
+
+void SimulationHistory::configure(std::size_t capacity, std::size_t interval) {
+    tickCapacity = std::max<std::size_t>(capacity, 1);
+    keyframeInterval = std::min(std::max<std::size_t>(interval, 1), tickCapacity);
+    ticks.resize(tickCapacity);
+    // A full window holds at most capacity / interval + 1 keyframes; one
+    // spare slot keeps the oldest from being overwritten while in use
+    keyframes.resize(tickCapacity / keyframeInterval + 2);
+    clear();
+}
+
+void SimulationHistory::clear() {
+    recording = false;
+    baseTick = 0;
+    endTick = 0;
+    for (Keyframe& keyframe : keyframes) {
+        keyframe.valid = false; // Buffers keep their storage for the next history
+    }
+}
+
+void SimulationHistory::record(const Simulation& simulation, const TickInput& input, float tickDelta) {
+    const Clock::time_point start = Clock::now();
+    const std::uint64_t tick = simulation.getTickCount();
+    if (!recording || tick < getOldestTick() || tick > endTick) {
+        clear();
+        recording = true;
+        baseTick = tick;
+    }
+    endTick = tick; // Anything ahead of this tick belonged to a timeline we left
+
+    if ((tick - baseTick) % keyframeInterval == 0) {
+        Keyframe& keyframe = keyframes[((tick - baseTick) / keyframeInterval) % keyframes.size()];
+        const Clock::time_point keyframeStart = Clock::now();
+        keyframe.state.clear();
+        simulation.saveState(keyframe.state);
+        keyframe.tick = tick;
+        keyframe.valid = true;
+        lastKeyframeUs = microsecondsSince(keyframeStart);
+    }
+    ticks[tick % tickCapacity] = LoggedTick{input, tickDelta, simulation.getWorldSize()};
+    endTick = tick + 1;
+
+    captureUsTotal += microsecondsSince(start);
+    ++ticksRecorded;
+}
+
+std::uint64_t SimulationHistory::seek(Simulation& simulation, std::uint64_t tick) {
+    if (!recording) return simulation.getTickCount();
+    const Clock::time_point start = Clock::now();
+    const std::uint64_t target = std::min(std::max(tick, getOldestTick()), endTick);
+    const std::uint64_t current = simulation.getTickCount();
+
+    Keyframe& keyframe = keyframeFor(target);
+    if (current < keyframe.tick || current > target) {
+        StateReader in(keyframe.state);
+        if (!keyframe.valid || !simulation.loadState(in)) {
+            clear(); // The pools were resized since; nothing recorded is loadable
+            return simulation.getTickCount();
+        }
+    }
+    lastSeekTicks = target - simulation.getTickCount();
+    replayTicks(simulation, target);
+    lastSeekMs = microsecondsSince(start) / 1000.f;
+    return simulation.getTickCount();
+}
+
+SimulationHistory::Keyframe& SimulationHistory::keyframeFor(std::uint64_t tick) {
+    // endTick itself has no keyframe yet, so it starts from the one before
+    const std::uint64_t last = std::min(tick, endTick - 1);
+    return keyframes[((last - baseTick) / keyframeInterval) % keyframes.size()];
+}
+
+void SimulationHistory::replayTicks(Simulation& simulation, std::uint64_t to) {
+    while (simulation.getTickCount() < to) {
+        const LoggedTick& logged = ticks[simulation.getTickCount() % tickCapacity];
+        if (logged.worldSize != simulation.getWorldSize()) {
+            simulation.setWorldSize(logged.worldSize);
+        }
+        simulation.step(logged.tickDelta, logged.input);
+    }
+}
+
+bool SimulationHistory::empty() const {
+    return !recording;
+}
+
+std::uint64_t SimulationHistory::getOldestTick() const {
+    if (!recording) return endTick;
+    // The oldest keyframe whose following ticks are all still in the log
+    const std::uint64_t windowStart = std::max(baseTick, endTick > tickCapacity ? endTick - tickCapacity : 0);
+    const std::uint64_t sinceBase = windowStart - baseTick;
+    return baseTick + (sinceBase + keyframeInterval - 1) / keyframeInterval * keyframeInterval;
+}
+
+std::uint64_t SimulationHistory::getNewestTick() const {
+    return endTick;
+}
+
+SimulationHistoryStats SimulationHistory::getStats() const {
+    SimulationHistoryStats stats;
+    stats.oldestTick = getOldestTick();
+    stats.newestTick = endTick;
+    for (const Keyframe& keyframe : keyframes) {
+        if (keyframe.valid && keyframe.tick >= stats.oldestTick && keyframe.tick < endTick) ++stats.keyframes;
+        stats.keyframeBytes += keyframe.state.capacity();
+    }
+    stats.lastKeyframeUs = lastKeyframeUs;
+    stats.captureUsPerTick = ticksRecorded > 0 ? static_cast<float>(captureUsTotal / ticksRecorded) : 0.f;
+    stats.lastSeekMs = lastSeekMs;
+    stats.lastSeekTicks = lastSeekTicks;
+    return stats;
+}
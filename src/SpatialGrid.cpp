@@ -0,0 +1,194 @@
+#include "SpatialGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr float DEFAULT_WORLD_WIDTH = 800.0f;
+    constexpr float DEFAULT_WORLD_HEIGHT = 600.0f;
+    constexpr float MIN_CELL_SIZE = 8.0f;
+    constexpr std::size_t MAX_CELLS = 1u << 20; // Cell size grows rather than exceed this
+
+    // Rebuilds touch every cell, so the cell count follows the target count
+    // rather than the world's area: big, sparse worlds get bigger cells. The
+    // budget moves in powers of two so it rarely forces a new layout.
+    constexpr std::size_t MIN_CELL_BUDGET = 1u << 12;
+    constexpr std::size_t CELLS_PER_TARGET = 8;
+
+    std::size_t cellBudget(std::size_t targetCount) {
+        std::size_t budget = MIN_CELL_BUDGET;
+        while (budget < targetCount * CELLS_PER_TARGET && budget < MAX_CELLS) {
+            budget *= 2;
+        }
+        return budget;
+    }
+
+    // Automatic sizes are whole multiples of the minimum, so the layout does
+    // not change (and force a rebuild) every time the largest radius wobbles
+    float roundUpToCellStep(float value) {
+        return std::ceil(value / MIN_CELL_SIZE) * MIN_CELL_SIZE;
+    }
+
+    // floor() for grid coordinates, clamped to [-1, limit] first so the
+    // conversion cannot overflow. Much cheaper than std::floor on baseline x86.
+    std::int32_t cellCoordinate(float scaled, std::int32_t limit) {
+        const float clamped = std::min(std::max(scaled, -1.f), static_cast<float>(limit));
+        const std::int32_t truncated = static_cast<std::int32_t>(clamped);
+        return truncated - (clamped < static_cast<float>(truncated) ? 1 : 0);
+    }
+}
+
+SpatialGrid::SpatialGrid()
+    : worldSize(DEFAULT_WORLD_WIDTH, DEFAULT_WORLD_HEIGHT),
+      requestedCellSize(0.f),
+      cellSize(0.f),
+      inverseCellSize(0.f),
+      columns(0),
+      rows(0),
+      rebuildCount(0),
+      cellStart(1, 0) {}
+
+void SpatialGrid::setWorldSize(const sf::Vector2f& size) {
+    worldSize = size;
+    cellSize = 0.f; // Forces a new layout on the next update
+}
+
+void SpatialGrid::setCellSize(float size) {
+    requestedCellSize = size;
+    cellSize = 0.f;
+}
+
+float SpatialGrid::getCellSize() const {
+    return cellSize;
+}
+
+bool SpatialGrid::update(const CollisionBodies& targets, float padding) {
+    bool changed = updateLayout(targets, padding);
+    if (spans.size() != targets.count) {
+        spans.resize(targets.count);
+        changed = true;
+    }
+
+    // Only the set of covered cells matters, so targets drifting inside
+    // their cells leave the buckets valid
+    for (std::size_t i = 0; i < targets.count; ++i) {
+        const CellSpan span = spanOf(targets.x[i], targets.y[i], targets.radius[i] + padding);
+        if (span != spans[i]) {
+            spans[i] = span;
+            changed = true;
+        }
+    }
+
+    if (changed) rebuildBuckets();
+    refreshEntries(targets);
+    return changed;
+}
+
+bool SpatialGrid::updateLayout(const CollisionBodies& targets, float padding) {
+    float size = requestedCellSize;
+    if (size <= 0.f) {
+        float maxRadius = 0.f;
+        for (std::size_t i = 0; i < targets.count; ++i) {
+            maxRadius = std::max(maxRadius, targets.radius[i]);
+        }
+        size = roundUpToCellStep(maxRadius + padding);
+    }
+    size = std::max(size, MIN_CELL_SIZE);
+    const float maxCells = static_cast<float>(cellBudget(targets.count));
+    while (std::ceil(worldSize.x / size) * std::ceil(worldSize.y / size) > maxCells) {
+        size *= 2.f;
+    }
+    if (size == cellSize) return false;
+
+    cellSize = size;
+    inverseCellSize = 1.f / size;
+    columns = std::max(1, static_cast<std::int32_t>(std::ceil(worldSize.x * inverseCellSize)));
+    rows = std::max(1, static_cast<std::int32_t>(std::ceil(worldSize.y * inverseCellSize)));
+    cellStart.assign(static_cast<std::size_t>(columns) * rows + 1, 0);
+    cellCursor.resize(cellStart.size());
+    return true;
+}
+
+SpatialGrid::CellSpan SpatialGrid::spanOf(float x, float y, float reach) const {
+    CellSpan span;
+    span.x0 = cellCoordinate((x - reach) * inverseCellSize, columns);
+    span.y0 = cellCoordinate((y - reach) * inverseCellSize, rows);
+    span.x1 = cellCoordinate((x + reach) * inverseCellSize, columns);
+    span.y1 = cellCoordinate((y + reach) * inverseCellSize, rows);
+    if (span.x1 < 0 || span.y1 < 0 || span.x0 >= columns || span.y0 >= rows) {
+        return CellSpan{1, 1, 0, 0}; // Entirely outside the world
+    }
+    span.x0 = std::max(span.x0, 0);
+    span.y0 = std::max(span.y0, 0);
+    span.x1 = std::min(span.x1, columns - 1);
+    span.y1 = std::min(span.y1, rows - 1);
+    return span;
+}
+
+void SpatialGrid::rebuildBuckets() {
+    // Count entries per cell, shifted by one so the prefix sum yields starts
+    std::fill(cellStart.begin(), cellStart.end(), 0);
+    for (const CellSpan& span : spans) {
+        for (std::int32_t cy = span.y0; cy <= span.y1; ++cy) {
+            for (std::int32_t cx = span.x0; cx <= span.x1; ++cx) {
+                ++cellStart[cy * columns + cx + 1];
+            }
+        }
+    }
+    for (std::size_t i = 1; i < cellStart.size(); ++i) {
+        cellStart[i] += cellStart[i - 1];
+    }
+
+    // Scatter in target order, so every bucket ends up sorted
+    entries.resize(cellStart.back());
+    std::copy(cellStart.begin(), cellStart.end(), cellCursor.begin());
+    for (std::size_t target = 0; target < spans.size(); ++target) {
+        const CellSpan& span = spans[target];
+        for (std::int32_t cy = span.y0; cy <= span.y1; ++cy) {
+            for (std::int32_t cx = span.x0; cx <= span.x1; ++cx) {
+                entries[cellCursor[cy * columns + cx]++].target = static_cast<std::uint32_t>(target);
+            }
+        }
+    }
+    ++rebuildCount;
+}
+
+void SpatialGrid::refreshEntries(const CollisionBodies& targets) {
+    for (GridEntry& entry : entries) {
+        entry.x = targets.x[entry.target];
+        entry.y = targets.y[entry.target];
+        entry.radius = targets.radius[entry.target];
+    }
+}
+
+std::int32_t SpatialGrid::cellAt(float x, float y) const {
+    const float fx = x * inverseCellSize;
+    const float fy = y * inverseCellSize;
+    // Written so NaN positions also fall outside. Truncation is floor here,
+    // since negative coordinates have been rejected.
+    if (!(fx >= 0.f && fy >= 0.f && fx < static_cast<float>(columns) && fy < static_cast<float>(rows))) return -1;
+    return static_cast<std::int32_t>(fy) * columns + static_cast<std::int32_t>(fx);
+}
+
+void SpatialGrid::queryCandidates(const float* x, const float* y, std::size_t count, std::vector<CollisionPair>& out) const {
+    if (cellSize <= 0.f) return;
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::int32_t cell = cellAt(x[i], y[i]);
+        if (cell < 0) continue;
+        for (const GridEntry* entry = cellBegin(cell); entry != cellEnd(cell); ++entry) {
+            out.push_back(CollisionPair{static_cast<std::uint32_t>(i), entry->target});
+        }
+    }
+}
+
+std::size_t SpatialGrid::getCellCount() const {
+    return cellStart.size() - 1;
+}
+
+std::size_t SpatialGrid::getEntryCount() const {
+    return entries.size();
+}
+
+std::size_t SpatialGrid::getRebuildCount() const {
+    return rebuildCount;
+}
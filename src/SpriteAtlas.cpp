@@ -0,0 +1,102 @@
+#include "SpriteAtlas.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr unsigned int ATLAS_WIDTH = 256;
+    constexpr unsigned int ATLAS_HEIGHT = 128;
+    constexpr unsigned int GAP = 4; // Transparent texels between sprites
+
+    // Disc
+    constexpr unsigned int DISC_SIZE = 64;
+    constexpr unsigned int DISC_X = GAP;
+    constexpr unsigned int DISC_Y = GAP;
+    constexpr float DISC_EDGE_SOFTNESS = 1.5f; // Texels of alpha falloff, for a cheap anti-aliased edge
+
+    // Ship, the triangle pointing up that used to be an sf::ConvexShape
+    constexpr float SHIP_NOSE_Y = -20.f;
+    constexpr float SHIP_BASE_Y = 15.f;
+    constexpr float SHIP_HALF_WIDTH = 15.f;
+    const sf::Vector2f SHIP_POINTS[3] = {{0.f, SHIP_NOSE_Y}, {-SHIP_HALF_WIDTH, SHIP_BASE_Y}, {SHIP_HALF_WIDTH, SHIP_BASE_Y}};
+    constexpr float SHIP_TEXELS_PER_UNIT = 2.f; // Baked at twice its size, so zooming in stays sharp
+    constexpr float SHIP_MARGIN = 1.f;          // Ship units around the triangle, room for its soft edge
+    constexpr float SHIP_WIDTH = 2.f * (SHIP_HALF_WIDTH + SHIP_MARGIN);
+    constexpr float SHIP_HEIGHT = SHIP_BASE_Y - SHIP_NOSE_Y + 2.f * SHIP_MARGIN;
+    const sf::FloatRect SHIP_BOUNDS(-SHIP_HALF_WIDTH - SHIP_MARGIN, SHIP_NOSE_Y - SHIP_MARGIN, SHIP_WIDTH, SHIP_HEIGHT);
+    constexpr unsigned int SHIP_X = DISC_X + DISC_SIZE + GAP;
+    constexpr unsigned int SHIP_Y = GAP;
+    constexpr unsigned int SHIP_TEXELS_X = static_cast<unsigned int>(SHIP_WIDTH * SHIP_TEXELS_PER_UNIT);
+    constexpr unsigned int SHIP_TEXELS_Y = static_cast<unsigned int>(SHIP_HEIGHT * SHIP_TEXELS_PER_UNIT);
+
+    static_assert(SHIP_X + SHIP_TEXELS_X + GAP <= ATLAS_WIDTH, "Atlas too narrow");
+    static_assert(SHIP_Y + SHIP_TEXELS_Y + GAP <= ATLAS_HEIGHT && DISC_Y + DISC_SIZE + GAP <= ATLAS_HEIGHT, "Atlas too short");
+
+    sf::Color white(float coverage) {
+        return sf::Color(255, 255, 255, static_cast<sf::Uint8>(std::min(std::max(coverage, 0.f), 1.f) * 255.f));
+    }
+
+    float cross(const sf::Vector2f& a, const sf::Vector2f& b) {
+        return a.x * b.y - a.y * b.x;
+    }
+}
+
+void SpriteAtlas::build() {
+    sf::Image image;
+    image.create(ATLAS_WIDTH, ATLAS_HEIGHT, sf::Color::Transparent);
+    bakeDisc(image);
+    bakeShip(image);
+    texture.loadFromImage(image);
+    texture.setSmooth(true);
+}
+
+const sf::Texture& SpriteAtlas::getTexture() const {
+    return texture;
+}
+
+sf::FloatRect SpriteAtlas::getRegion(Sprite sprite) const {
+    switch (sprite) {
+        case Sprite::Disc:
+            return sf::FloatRect(DISC_X, DISC_Y, DISC_SIZE, DISC_SIZE);
+        case Sprite::Ship:
+        default:
+            return sf::FloatRect(SHIP_X, SHIP_Y, SHIP_TEXELS_X, SHIP_TEXELS_Y);
+    }
+}
+
+sf::FloatRect SpriteAtlas::getShipBounds() const {
+    return SHIP_BOUNDS;
+}
+
+void SpriteAtlas::bakeDisc(sf::Image& image) const {
+    const float center = DISC_SIZE / 2.f;
+    for (unsigned int y = 0; y < DISC_SIZE; ++y) {
+        for (unsigned int x = 0; x < DISC_SIZE; ++x) {
+            const float dx = x + 0.5f - center;
+            const float dy = y + 0.5f - center;
+            image.setPixel(DISC_X + x, DISC_Y + y, white((center - std::sqrt(dx * dx + dy * dy)) / DISC_EDGE_SOFTNESS));
+        }
+    }
+}
+
+// Coverage is the distance inside the nearest edge, in texels, so the edge
+// gets about one texel of falloff
+void SpriteAtlas::bakeShip(sf::Image& image) const {
+    for (unsigned int y = 0; y < SHIP_TEXELS_Y; ++y) {
+        for (unsigned int x = 0; x < SHIP_TEXELS_X; ++x) {
+            const sf::Vector2f p(SHIP_BOUNDS.left + (x + 0.5f) / SHIP_TEXELS_PER_UNIT,
+                                 SHIP_BOUNDS.top + (y + 0.5f) / SHIP_TEXELS_PER_UNIT);
+            float inside = SHIP_WIDTH; // Larger than any distance inside
+            for (int i = 0; i < 3; ++i) {
+                const sf::Vector2f& a = SHIP_POINTS[i];
+                const sf::Vector2f& b = SHIP_POINTS[(i + 1) % 3];
+                const sf::Vector2f& c = SHIP_POINTS[(i + 2) % 3];
+                const sf::Vector2f edge = b - a;
+                const float length = std::sqrt(edge.x * edge.x + edge.y * edge.y);
+                const float side = cross(edge, c - a) > 0.f ? 1.f : -1.f; // Positive towards the opposite corner
+                inside = std::min(inside, side * cross(edge, p - a) / length);
+            }
+            image.setPixel(SHIP_X + x, SHIP_Y + y, white(inside * SHIP_TEXELS_PER_UNIT + 0.5f));
+        }
+    }
+}
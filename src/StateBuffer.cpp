@@ -0,0 +1,26 @@
+#include "StateBuffer.hpp"
+
+void StateBuffer::append(const void* data, std::size_t count) {
+    if (count == 0) return;
+    if (used + count > bytes.size()) {
+        bytes.resize(used + count); // Only ever grows, so steady-state captures don't allocate
+    }
+    std::memcpy(bytes.data() + used, data, count);
+    used += count;
+}
+
+StateReader::StateReader(const std::uint8_t* data, std::size_t size)
+    : data(data), size(size), offset(0), failed(false) {}
+
+StateReader::StateReader(const StateBuffer& buffer)
+    : StateReader(buffer.data(), buffer.size()) {}
+
+const std::uint8_t* StateReader::take(std::size_t count) {
+    if (failed || count > size - offset) {
+        failed = true;
+        return nullptr;
+    }
+    const std::uint8_t* start = data + offset;
+    offset += count;
+    return start;
+}
@@ -0,0 +1,88 @@
+#include "WorldChunks.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr float DEFAULT_WORLD_WIDTH = 800.0f;
+    constexpr float DEFAULT_WORLD_HEIGHT = 600.0f;
+}
+
+WorldChunks::WorldChunks(float size)
+    : worldSize(0.f, 0.f),
+      chunkSize(size),
+      inverseChunkSize(1.f / size),
+      columns(0),
+      rows(0)
+{
+    setWorldSize(sf::Vector2f(DEFAULT_WORLD_WIDTH, DEFAULT_WORLD_HEIGHT));
+}
+
+void WorldChunks::setWorldSize(const sf::Vector2f& size) {
+    if (size == worldSize) return;
+    worldSize = size;
+    columns = std::max(1, static_cast<std::int32_t>(std::ceil(size.x * inverseChunkSize)));
+    rows = std::max(1, static_cast<std::int32_t>(std::ceil(size.y * inverseChunkSize)));
+    chunkStart.assign(static_cast<std::size_t>(columns) * rows + 1, 0);
+    indices.clear(); // Nothing is bucketed for the new layout yet
+}
+
+// Clamped, so out-of-world points still land in a chunk
+std::int32_t WorldChunks::column(float x) const {
+    const float scaled = std::min(std::max(x * inverseChunkSize, 0.f), static_cast<float>(columns - 1));
+    return static_cast<std::int32_t>(scaled);
+}
+
+std::int32_t WorldChunks::row(float y) const {
+    const float scaled = std::min(std::max(y * inverseChunkSize, 0.f), static_cast<float>(rows - 1));
+    return static_cast<std::int32_t>(scaled);
+}
+
+void WorldChunks::build(const float* x, const float* y, std::size_t count) {
+    if (chunkOf.size() < count) chunkOf.resize(count);
+    if (indices.size() < count) indices.resize(count);
+
+    // Count per chunk, shifted by one so the prefix sum yields starts
+    std::fill(chunkStart.begin(), chunkStart.end(), 0);
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::uint32_t chunk = static_cast<std::uint32_t>(row(y[i]) * columns + column(x[i]));
+        chunkOf[i] = chunk;
+        ++chunkStart[chunk + 1];
+    }
+    for (std::size_t i = 1; i < chunkStart.size(); ++i) {
+        chunkStart[i] += chunkStart[i - 1];
+    }
+
+    // Scatter in index order, using each chunk's start as its cursor, then
+    // shift the starts back into place
+    for (std::size_t i = 0; i < count; ++i) {
+        indices[chunkStart[chunkOf[i]]++] = static_cast<std::uint32_t>(i);
+    }
+    for (std::size_t i = chunkStart.size() - 1; i > 0; --i) {
+        chunkStart[i] = chunkStart[i - 1];
+    }
+    chunkStart[0] = 0;
+}
+
+// Clamped like the points, so edge chunks also answer for everything beyond them
+std::size_t WorldChunks::query(float minX, float minY, float maxX, float maxY, std::vector<std::uint32_t>& out) const {
+    const std::int32_t x0 = column(minX);
+    const std::int32_t x1 = column(maxX);
+    const std::int32_t y0 = row(minY);
+    const std::int32_t y1 = row(maxY);
+    for (std::int32_t cy = y0; cy <= y1; ++cy) {
+        // A row of chunks is contiguous in indices, so copy it in one go
+        const std::uint32_t begin = chunkStart[cy * columns + x0];
+        const std::uint32_t end = chunkStart[cy * columns + x1 + 1];
+        out.insert(out.end(), indices.begin() + begin, indices.begin() + end);
+    }
+    return static_cast<std::size_t>(x1 - x0 + 1) * (y1 - y0 + 1);
+}
+
+float WorldChunks::getChunkSize() const {
+    return chunkSize;
+}
+
+std::size_t WorldChunks::getChunkCount() const {
+    return chunkStart.size() - 1;
+}
@@ -0,0 +1,81 @@
+#include "WorldRenderer.hpp"
+#include "RenderQueue.hpp"
+#include "RenderSnapshot.hpp"
+#include "SpriteAtlas.hpp"
+
+#include <cmath>
+
+namespace {
+    // Ship Visuals
+    const sf::Color PLAYER_COLOR = sf::Color::Green;
+
+    // Projectile Visuals
+    constexpr float POINT_RADIUS_THRESHOLD = 1.0f; // Below this a projectile is drawn as a single point
+
+    // Calculation Constants
+    constexpr float PI = 3.14159265f;
+}
+
+void WorldRenderer::drawPlayer(RenderQueue& queue, const SpriteAtlas& atlas, const sf::Vector2f& position, float rotation,
+                               float scale) {
+    // Same transform sf::Transformable applied to the old shape: scale, rotate, then move
+    const float radians = rotation * PI / 180.f;
+    const float c = std::cos(radians) * scale;
+    const float s = std::sin(radians) * scale;
+    auto place = [&position, c, s](float x, float y) {
+        return sf::Vector2f(position.x + x * c - y * s, position.y + x * s + y * c);
+    };
+
+    const sf::FloatRect local = atlas.getShipBounds();
+    const sf::FloatRect texels = atlas.getRegion(SpriteAtlas::Sprite::Ship);
+    sf::Vertex* quad = queue.push(RenderLayer::World, sf::Quads, &atlas.getTexture(), RenderBlend::Alpha, 4);
+    quad[0] = sf::Vertex(place(local.left, local.top), PLAYER_COLOR, sf::Vector2f(texels.left, texels.top));
+    quad[1] = sf::Vertex(place(local.left + local.width, local.top), PLAYER_COLOR,
+                         sf::Vector2f(texels.left + texels.width, texels.top));
+    quad[2] = sf::Vertex(place(local.left + local.width, local.top + local.height), PLAYER_COLOR,
+                         sf::Vector2f(texels.left + texels.width, texels.top + texels.height));
+    quad[3] = sf::Vertex(place(local.left, local.top + local.height), PLAYER_COLOR,
+                         sf::Vector2f(texels.left, texels.top + texels.height));
+}
+
+// Discs first, then the points; each is one command, so the discs batch
+// with the asteroids and the ship
+void WorldRenderer::drawProjectiles(RenderQueue& queue, const SpriteAtlas& atlas, const RenderBodies& projectiles, float alpha) {
+    const std::size_t count = projectiles.count;
+    if (count == 0) return;
+    const float* curX = projectiles.x.data();
+    const float* curY = projectiles.y.data();
+    const float* prevX = projectiles.prevX.data();
+    const float* prevY = projectiles.prevY.data();
+    const float* radii = projectiles.radius.data();
+    const std::uint32_t* colors = projectiles.color.data();
+    const sf::FloatRect disc = atlas.getRegion(SpriteAtlas::Sprite::Disc);
+    const sf::Vector2f discEnd(disc.left + disc.width, disc.top + disc.height);
+
+    sf::Vertex* quads = queue.push(RenderLayer::World, sf::Quads, &atlas.getTexture(), RenderBlend::Alpha, count * 4);
+    std::size_t quadVertices = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        const float r = radii[i];
+        if (r < POINT_RADIUS_THRESHOLD) continue;
+        const float x = prevX[i] + (curX[i] - prevX[i]) * alpha;
+        const float y = prevY[i] + (curY[i] - prevY[i]) * alpha;
+        const sf::Color color(colors[i]);
+        sf::Vertex* quad = quads + quadVertices;
+        quad[0] = sf::Vertex(sf::Vector2f(x - r, y - r), color, sf::Vector2f(disc.left, disc.top));
+        quad[1] = sf::Vertex(sf::Vector2f(x + r, y - r), color, sf::Vector2f(discEnd.x, disc.top));
+        quad[2] = sf::Vertex(sf::Vector2f(x + r, y + r), color, discEnd);
+        quad[3] = sf::Vertex(sf::Vector2f(x - r, y + r), color, sf::Vector2f(disc.left, discEnd.y));
+        quadVertices += 4;
+    }
+    queue.shrinkLast(quadVertices);
+    if (quadVertices == count * 4) return;
+
+    sf::Vertex* points = queue.push(RenderLayer::World, sf::Points, nullptr, RenderBlend::Alpha, count - quadVertices / 4);
+    std::size_t pointVertices = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (radii[i] >= POINT_RADIUS_THRESHOLD) continue;
+        const float x = prevX[i] + (curX[i] - prevX[i]) * alpha;
+        const float y = prevY[i] + (curY[i] - prevY[i]) * alpha;
+        points[pointVertices++] = sf::Vertex(sf::Vector2f(x, y), sf::Color(colors[i]));
+    }
+}
@@ -1,10 +1,103 @@
 #include "Game.hpp"
+#include "Headless.hpp"
 
 #include <SFML/Graphics.hpp>
 
-int main() {
-    sf::RenderWindow window(sf::VideoMode(800, 600), "Asteroids Skeleton");
+#include <cstdlib>
+#include <optional>
+#include <string>
+
+namespace {
+    // Returns the value of "--name=value" style arguments, or nullptr
+    const char* optionValue(const std::string& arg, const std::string& name) {
+        const std::string prefix = "--" + name + "=";
+        return arg.compare(0, prefix.size(), prefix) == 0 ? arg.c_str() + prefix.size() : nullptr;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    // Options are collected first, so a headless run never constructs Game
+    // (its job system and window-side resources)
+    bool headless = false;
+    HeadlessOptions headlessOptions;
+    std::size_t asteroidCount = 0;
+    std::size_t threadCount = 0; // One per core
+    std::string recordPath;
+    std::string replayPath;
+    std::optional<float> tickRate;
+    std::optional<float> timeScale;
+    std::optional<int> maxSteps;
+    std::optional<sf::Vector2f> worldSize;
+    std::optional<float> frameRate;
+    bool vsync = false;
+    bool renderThread = true;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--headless") {
+            headless = true;
+        } else if (const char* value = optionValue(arg, "ticks")) {
+            headlessOptions.ticks = std::strtoull(value, nullptr, 10);
+        } else if (const char* value = optionValue(arg, "tick-rate")) {
+            tickRate = std::strtof(value, nullptr);
+        } else if (const char* value = optionValue(arg, "time-scale")) {
+            timeScale = std::strtof(value, nullptr);
+        } else if (const char* value = optionValue(arg, "max-steps")) {
+            maxSteps = std::atoi(value);
+        } else if (const char* value = optionValue(arg, "threads")) {
+            threadCount = std::strtoull(value, nullptr, 10);
+        } else if (const char* value = optionValue(arg, "world")) {
+            char* end = nullptr;
+            sf::Vector2f size;
+            size.x = std::strtof(value, &end);
+            size.y = *end == 'x' ? std::strtof(end + 1, nullptr) : size.x;
+            worldSize = size;
+        } else if (const char* value = optionValue(arg, "asteroids")) {
+            asteroidCount = std::strtoull(value, nullptr, 10);
+        } else if (const char* value = optionValue(arg, "fps")) {
+            frameRate = std::strtof(value, nullptr);
+        } else if (arg == "--vsync") {
+            vsync = true;
+        } else if (const char* value = optionValue(arg, "record")) {
+            recordPath = value;
+        } else if (const char* value = optionValue(arg, "replay")) {
+            replayPath = value;
+        } else if (const char* value = optionValue(arg, "render-thread")) {
+            renderThread = std::string(value) != "off";
+        }
+    }
+
+    // Headless mode never opens a window or touches the GPU
+    if (headless) {
+        if (tickRate) headlessOptions.tickRate = *tickRate;
+        if (worldSize) headlessOptions.worldSize = *worldSize;
+        headlessOptions.asteroids = asteroidCount;
+        headlessOptions.threads = threadCount;
+        headlessOptions.recordPath = recordPath;
+        headlessOptions.replayPath = replayPath;
+        return runHeadless(headlessOptions);
+    }
+
     Game game;
+    if (tickRate) game.setTickRate(*tickRate);
+    if (timeScale) game.setTimeScale(*timeScale);
+    if (maxSteps) game.setMaxStepsPerFrame(*maxSteps);
+    if (worldSize) game.setWorldSize(*worldSize);
+    if (frameRate) {
+        game.setFrameRateLimit(*frameRate);
+    } else if (vsync) {
+        game.setFrameRateLimit(0.f); // The display paces frames; the default limit would fight it
+    }
+    game.setVsyncEnabled(vsync);
+    game.setRenderThreadEnabled(renderThread);
+    game.setThreadCount(threadCount);
+    game.openAssetPack(argv[0]);
+    sf::RenderWindow window(sf::VideoMode(800, 600), "Asteroids Skeleton");
+    if (replayPath.empty()) {
+        game.getSimulation().spawnAsteroids(asteroidCount);
+    } else if (!game.loadReplay(replayPath)) {
+        return 1;
+    }
+    game.setRecordPath(recordPath);
     game.run(window);
-    return 0;
-}
\ No newline at end of file
+    return game.hasReplayDiverged() ? 1 : 0;
+}
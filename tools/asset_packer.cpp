@@ -0,0 +1,39 @@
+// Packs every file under an assets directory into one memory-mappable pack.
+// Run by the build: asset_packer <assets dir> <output pack>
+#include "AssetPack.hpp"
+
+#include <filesystem>
+#include <iostream>
+
+namespace fs = std::filesystem;
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        std::cerr << "usage: asset_packer <assets dir> <output pack>" << std::endl;
+        return 1;
+    }
+    const fs::path assetDir = argv[1];
+
+    std::vector<AssetPackSource> sources;
+    std::error_code ec;
+    for (fs::recursive_directory_iterator it(assetDir, ec), end; it != end; it.increment(ec)) {
+        if (ec) break;
+        if (!it->is_regular_file()) continue;
+        AssetPackSource source;
+        source.name = fs::relative(it->path(), assetDir).generic_string();
+        source.path = it->path().string();
+        sources.push_back(source);
+    }
+    if (ec) {
+        std::cerr << "asset_packer: " << assetDir << ": " << ec.message() << std::endl;
+        return 1;
+    }
+
+    std::string error;
+    if (!AssetPack::write(argv[2], sources, error)) {
+        std::cerr << "asset_packer: " << error << std::endl;
+        return 1;
+    }
+    std::cout << "Packed " << sources.size() << " assets into " << argv[2] << std::endl;
+    return 0;
+}
@@ -0,0 +1,135 @@
+// Load test for game_server: connects N scripted bot clients over UDP and
+// reports bandwidth per client, snapshot health, prediction error and the
+// server's tick time as reported in its snapshots.
+//   net_bots [--clients=64] [--server=127.0.0.1] [--port=N] [--seconds=10] [--warmup=2]
+#include "NetClient.hpp"
+#include "Headless.hpp"
+#include "FramePacer.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr float CONNECT_TIMEOUT_S = 2.f;
+    constexpr double KIB = 1024.0;
+
+    // Returns the value of "--name=value" style arguments, or nullptr
+    const char* optionValue(const std::string& arg, const std::string& name) {
+        const std::string prefix = "--" + name + "=";
+        return arg.compare(0, prefix.size(), prefix) == 0 ? arg.c_str() + prefix.size() : nullptr;
+    }
+
+    float percentile(std::vector<float> values, float fraction) {
+        if (values.empty()) return 0.f;
+        const std::size_t index = static_cast<std::size_t>(fraction * (values.size() - 1));
+        std::nth_element(values.begin(), values.begin() + index, values.end());
+        return values[index];
+    }
+
+    struct Bot {
+        NetClient client;
+        std::unique_ptr<ScriptedInput> script;
+    };
+}
+
+int main(int argc, char* argv[]) {
+    std::size_t clientCount = 64;
+    std::string serverAddress = "127.0.0.1";
+    unsigned short port = NET_DEFAULT_PORT;
+    float seconds = 10.f;
+    float warmupSeconds = 2.f; // Excluded from the numbers: connects and full snapshots
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (const char* value = optionValue(arg, "clients")) {
+            clientCount = std::strtoull(value, nullptr, 10);
+        } else if (const char* value = optionValue(arg, "server")) {
+            serverAddress = value;
+        } else if (const char* value = optionValue(arg, "port")) {
+            port = static_cast<unsigned short>(std::atoi(value));
+        } else if (const char* value = optionValue(arg, "seconds")) {
+            seconds = std::strtof(value, nullptr);
+        } else if (const char* value = optionValue(arg, "warmup")) {
+            warmupSeconds = std::strtof(value, nullptr);
+        }
+    }
+
+    std::vector<std::unique_ptr<Bot>> bots;
+    for (std::size_t i = 0; i < clientCount; ++i) {
+        auto bot = std::make_unique<Bot>();
+        if (!bot->client.connect(sf::IpAddress(serverAddress), port, sf::seconds(CONNECT_TIMEOUT_S))) {
+            std::cerr << "Bot " << i << " couldn't connect to " << serverAddress << ":" << port << std::endl;
+            return 1;
+        }
+        bot->script = std::make_unique<ScriptedInput>(bot->client.getTickRate());
+        bots.push_back(std::move(bot));
+    }
+    if (bots.empty()) return 0;
+
+    const float tickRate = bots.front()->client.getTickRate();
+    FramePacer pacer;
+    pacer.setTargetRate(tickRate);
+    const std::uint64_t warmupTicks = static_cast<std::uint64_t>(warmupSeconds * tickRate);
+    const std::uint64_t totalTicks = warmupTicks + static_cast<std::uint64_t>(seconds * tickRate);
+
+    std::vector<float> serverTickMs;
+    for (std::uint64_t tick = 0; tick < totalTicks; ++tick) {
+        if (tick == warmupTicks) {
+            for (auto& bot : bots) bot->client.resetStats();
+            serverTickMs.clear();
+        }
+        for (auto& bot : bots) {
+            bot->client.receive();
+            bot->client.sendInput(bot->script->nextTick());
+        }
+        serverTickMs.push_back(bots.front()->client.getStats().serverTickUs / 1000.f);
+        pacer.waitForNextFrame();
+    }
+
+    // Per-client averages over the measured window
+    std::vector<float> downKiBs;
+    std::vector<float> upKiBs;
+    NetClientStats total;
+    for (auto& bot : bots) {
+        const NetClientStats stats = bot->client.getStats();
+        downKiBs.push_back(static_cast<float>(stats.bytesReceived / KIB / seconds));
+        upKiBs.push_back(static_cast<float>(stats.bytesSent / KIB / seconds));
+        total.snapshotsReceived += stats.snapshotsReceived;
+        total.fullSnapshots += stats.fullSnapshots;
+        total.staleSnapshots += stats.staleSnapshots;
+        total.undecodableSnapshots += stats.undecodableSnapshots;
+        total.reassembledSnapshots += stats.reassembledSnapshots;
+        total.rejectedSnapshots += stats.rejectedSnapshots;
+        total.corrections += stats.corrections;
+        total.totalPredictionError += stats.totalPredictionError;
+        total.maxPredictionError = std::max(total.maxPredictionError, stats.maxPredictionError);
+    }
+    const NetWorldState& world = bots.front()->client.getWorldState();
+    const std::size_t shipCount = world.ships.size();
+    const std::size_t projectileCount = world.projectiles.size();
+    for (auto& bot : bots) {
+        bot->client.disconnect();
+    }
+
+    double downTotal = 0.0;
+    for (float value : downKiBs) downTotal += value;
+    std::cout << "Net bots: " << bots.size() << " clients, " << seconds << " s at " << tickRate << " Hz\n"
+              << "  World:             " << shipCount << " ships, " << projectileCount << " projectiles\n"
+              << "  Down per client:   avg " << downTotal / bots.size() << " KiB/s, min "
+              << *std::min_element(downKiBs.begin(), downKiBs.end()) << ", max "
+              << *std::max_element(downKiBs.begin(), downKiBs.end()) << "\n"
+              << "  Up per client:     median " << percentile(upKiBs, 0.5f) << " KiB/s\n"
+              << "  Snapshots:         " << total.snapshotsReceived / static_cast<double>(bots.size()) / seconds
+              << " /s per client, " << total.fullSnapshots << " full, " << total.staleSnapshots << " stale, "
+              << total.undecodableSnapshots << " undecodable, " << total.reassembledSnapshots << " reassembled, "
+              << total.rejectedSnapshots << " rejected\n"
+              << "  Prediction error:  avg "
+              << (total.snapshotsReceived > 0 ? total.totalPredictionError / total.snapshotsReceived : 0.0)
+              << " px, max " << total.maxPredictionError << " px, " << total.corrections << " corrections\n"
+              << "  Server tick:       p50 " << percentile(serverTickMs, 0.5f) << " ms, p99 "
+              << percentile(serverTickMs, 0.99f) << " ms" << std::endl;
+    return 0;
+}